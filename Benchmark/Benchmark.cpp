@@ -0,0 +1,551 @@
+#include "MCTS.h"
+#include "Graph.h"
+#include "GridTree.h"
+#include "Minimax.h"
+#include "AlphaBeta.h"
+#include "Playout.h"
+#include "Policy.h"
+#include "GameTable.h"
+#include "Clock.h"
+#include <iostream>
+#include <thread>
+#include <vector>
+#include <string_view>
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <cmath>
+#include <new>
+
+//--------------------------------------------------------------------------------------------------
+
+namespace
+{
+	// Alocações feitas pelo processo (contadas pelo operator new global abaixo)
+	std::atomic<uint64_t> allocations{};
+}
+
+//--------------------------------------------------------------------------------------------------
+
+void* operator new(size_t size)
+{
+	allocations.fetch_add(1, std::memory_order_relaxed);
+
+	if (void* pointer{ std::malloc(size ? size : 1) })
+		return pointer;
+
+	throw std::bad_alloc{};
+}
+
+//--------------------------------------------------------------------------------------------------
+
+void operator delete(void* pointer) noexcept
+{
+	std::free(pointer);
+}
+
+//--------------------------------------------------------------------------------------------------
+
+void operator delete(void* pointer, size_t) noexcept
+{
+	std::free(pointer);
+}
+
+//--------------------------------------------------------------------------------------------------
+
+namespace
+{
+	struct Settings
+	{
+		uint32_t seed{ 1 };
+		int      iterations{ 10000 };  // Iterações do MCTS por busca
+		int      repeat{ 20 };         // Buscas por posição
+		int      rollouts{ 1 };        // Simulações por folha do MCTS
+		float    rave{};               // Parâmetro k do RAVE (0 = sem a variante com RAVE)
+		int      raveIterations{};     // Iterações da variante com RAVE (0 = metade de `iterations`)
+		bool     scaling{};            // Mede também o escalonamento com threads
+		float    gomoku{};             // Prazo por jogada do aprofundamento iterativo no Gomoku (0 = não mede)
+	};
+
+	// Posições fixas com O (a IA) na vez: linha a linha, '.' = vazia
+	constexpr std::string_view suite[]
+	{
+		"X........",  // Abertura no canto
+		"....X....",  // Abertura no centro
+		".X.......",  // Abertura na borda
+		"X...O...X",  // Cantos opostos
+		"XX..O....",  // O precisa bloquear
+		"XO..X....",  // O precisa bloquear a diagonal
+		"OX..XO..X",  // Meio de jogo
+		"XOX.O.X..",  // O vence em uma jogada
+	};
+
+	// Resultado acumulado de um motor sobre a suíte
+	struct Sample
+	{
+		std::vector<float> latencies;  // ms por busca
+		uint64_t           nodes{};
+		uint64_t           iterations{};
+		uint64_t           allocations{};
+		uint64_t           optimal{};    // Jogadas que preservam o valor teórico da posição
+		float              seconds{};
+	};
+
+	Board Parse(std::string_view position)
+	{
+		Board board;
+		for (int square{}; square < Board::Size; ++square)
+			board.Set(square, position[square] == 'X' ? Player::X : position[square] == 'O' ? Player::O : Player::None);
+
+		return board;
+	}
+
+	// A jogada mantém o resultado teórico (vitória, empate ou derrota) da posição?
+	bool Optimal(const Board& before, const Board& after)
+	{
+		const int expected{ GameTable::Lookup(before, before.Turn()).value };
+		const int obtained{ -GameTable::Lookup(after, after.Turn()).value };
+
+		return (expected > 0) == (obtained > 0) && (expected < 0) == (obtained < 0);
+	}
+
+	// Mede uma busca: a função joga sobre o tabuleiro e retorna { nós, iterações }
+	template <typename Search>
+	void Measure(Sample& sample, const Board& position, Search search)
+	{
+		Board board{ position };
+		const uint64_t before{ allocations.load(std::memory_order_relaxed) };
+		Clock clock;
+
+		const auto [nodes, iterations] { search(board) };
+
+		const float elapsed{ clock.Count() };
+		sample.allocations += allocations.load(std::memory_order_relaxed) - before;
+		sample.latencies.push_back(elapsed * 1000);
+		sample.seconds += elapsed;
+		sample.nodes += nodes;
+		sample.iterations += iterations;
+		sample.optimal += Optimal(position, board);
+	}
+
+	// Percentil pelo posto mais próximo (latências já ordenadas)
+	float Percentile(const std::vector<float>& sorted, float percent)
+	{
+		const size_t rank{ size_t(std::ceil(percent / 100 * sorted.size())) };
+		return sorted[std::max<size_t>(rank, 1) - 1];
+	}
+
+	void Report(std::string_view name, Sample& sample, bool first)
+	{
+		std::sort(sample.latencies.begin(), sample.latencies.end());
+		const size_t searches{ sample.latencies.size() };
+
+		std::cout << (first ? "" : ",\n") << "    \"" << name << "\": {\n"
+			<< "      \"searches\": " << searches << ",\n"
+			<< "      \"nodes\": " << sample.nodes << ",\n"
+			<< "      \"nodes_per_sec\": " << sample.nodes / sample.seconds << ",\n"
+			<< "      \"iterations_per_sec\": " << sample.iterations / sample.seconds << ",\n"
+			<< "      \"allocations_per_search\": " << double(sample.allocations) / searches << ",\n"
+			<< "      \"optimal_moves\": " << double(sample.optimal) / searches << ",\n"
+			<< "      \"allocations_per_iteration\": " << (sample.iterations ? double(sample.allocations) / sample.iterations : 0) << ",\n"
+			<< "      \"latency_ms\": { \"p50\": " << Percentile(sample.latencies, 50)
+			<< ", \"p95\": " << Percentile(sample.latencies, 95)
+			<< ", \"p99\": " << Percentile(sample.latencies, 99) << " }\n"
+			<< "    }";
+	}
+
+	// Simulações por segundo do núcleo em lote com cada conjunto de instruções disponível
+	void Playouts(const Settings& settings)
+	{
+		constexpr int count{ 1024 };
+		const Playout::Instructions supported{ Playout::Supported() };
+
+		std::cout << ",\n  \"playouts\": {\n"
+			<< "    \"supported\": \"" << Playout::Name(supported) << "\"";
+
+		for (int level{ Playout::Scalar }; level <= supported; ++level)
+		{
+			const auto instructions{ Playout::Instructions(level) };
+			Playout::Use(instructions);
+
+			Random random{ settings.seed };
+			int total{};
+			Clock clock;
+
+			for (int round{}; round < settings.repeat; ++round)
+			{
+				for (const auto position : suite)
+					total += Playout::Run(Parse(position), Player::O, count, random);
+			}
+
+			const float rate{ settings.repeat * std::size(suite) * count / clock.Count() };
+			std::cout << ",\n    \"" << Playout::Name(instructions) << "\": { \"playouts_per_sec\": " << rate << ", \"score\": " << total << " }";
+		}
+
+		Playout::Use(supported);
+		std::cout << "\n  }";
+	}
+
+	// Posição da suíte no tabuleiro m,n,k equivalente
+	Grid<3, 3, 3> ToGrid(std::string_view position)
+	{
+		Grid<3, 3, 3> grid;
+		for (int square{}; square < Board::Size; ++square)
+		{
+			if (position[square] != '.')
+				grid.Play(square, position[square] == 'X' ? Player::X : Player::O);
+		}
+
+		return grid;
+	}
+
+	// Motores genéricos de m,n,k: a suíte no 3,3,3 (jogadas conferidas com a busca completa) e uma
+	// vitória em uma jogada no Gomoku, que os dois precisam encontrar
+	void Grids(const Settings& settings)
+	{
+		const float c{ 1 / std::sqrt(2.f) };
+		int optimal{};
+		Clock clock;
+
+		MCTS::GridTree<3, 3, 3> small;
+		small.Seed(settings.seed);
+
+		for (const auto position : suite)
+		{
+			Grid<3, 3, 3> grid{ ToGrid(position) };
+			const int expected{ Minimax::Search(grid, Player::O, Board::Size).first };
+
+			// A jogada mantém o sinal do valor teórico?
+			const int move{ small.Search(grid, Player::O, settings.iterations, c) };
+			grid.Play(move, Player::O);
+			const int obtained{ grid.Winner() == Player::O ? 1 : -Minimax::Search(grid, Player::X, Board::Size).first };
+
+			optimal += (expected > 0) == (obtained > 0) && (expected < 0) == (obtained < 0);
+		}
+
+		const float smallSeconds{ clock.Count() };
+
+		// O tem quatro em linha aberta na linha 7 (colunas 5 a 8): vence em 109 ou 114
+		Gomoku gomoku;
+		for (const int square : { 110, 111, 112, 113 })
+			gomoku.Play(square, Player::O);
+		for (const int square : { 95, 96, 97, 125, 140 })
+			gomoku.Play(square, Player::X);
+
+		auto wins{ [](int move) { return move == 109 || move == 114; } };
+
+		clock.Reset();
+		const int minimaxMove{ Minimax::Search(gomoku, Player::O, 2).second };
+		const float minimaxSeconds{ clock.Count() };
+
+		MCTS::GridTree<15, 15, 5> large;
+		large.Seed(settings.seed);
+
+		clock.Reset();
+		const int mctsMove{ large.Search(gomoku, Player::O, settings.iterations, c) };
+		const float mctsSeconds{ clock.Count() };
+
+		std::cout << ",\n  \"grids\": {\n"
+			<< "    \"3,3,3\": { \"positions\": " << std::size(suite)
+			<< ", \"mcts_optimal_moves\": " << double(optimal) / std::size(suite)
+			<< ", \"ms\": " << smallSeconds * 1000 << " },\n"
+			<< "    \"gomoku\": { \"minimax_move\": " << minimaxMove << ", \"minimax_wins\": " << (wins(minimaxMove) ? "true" : "false")
+			<< ", \"minimax_ms\": " << minimaxSeconds * 1000
+			<< ", \"mcts_move\": " << mctsMove << ", \"mcts_wins\": " << (wins(mctsMove) ? "true" : "false")
+			<< ", \"mcts_iterations_per_sec\": " << settings.iterations / mctsSeconds << " }\n"
+			<< "  }";
+	}
+
+	// Posições aleatórias com o jogador da vez; o valor do aprofundamento iterativo com prazo folgado
+	// deve ser o mesmo da busca completa. Retorna quantas coincidiram
+	template <int M, int N, int K>
+	int Agreement(Random& random, int positions)
+	{
+		int matches{};
+
+		for (int i{}; i < positions; ++i)
+		{
+			Grid<M, N, K> grid;
+			Player player{ Player::X };
+
+			// Sorteia até metade das casas, sem chegar a um estado terminal
+			for (int stones{ int(random.Below(M * N / 2 + 1)) }; stones > 0; --stones)
+			{
+				const typename Grid<M, N, K>::Moves moves{ grid.Available() };
+				const int square{ moves.Select(int(random.Below(uint32_t(moves.Count())))) };
+
+				if (grid.Play(square, player))
+				{
+					grid.Undo(square);
+					break;
+				}
+
+				player = Player(-player);
+			}
+
+			const int expected{ Minimax::Search(grid, player, M * N).first };
+			matches += Minimax::SearchFor(grid, player, 1e4f).value == expected;
+		}
+
+		return matches;
+	}
+
+	// Aprofundamento iterativo no Gomoku: tempo gasto, profundidade e nós contra o prazo dado
+	void Deepening(const Settings& settings)
+	{
+		// Tabuleiro vazio, quatro em linha aberta de O (vitória em uma) e um meio de jogo
+		const std::vector<int> positions[][2]
+		{
+			{ {}, {} },
+			{ { 110, 111, 112, 113 }, { 95, 96, 97, 125, 140 } },
+			{ { 96, 112, 113, 127 }, { 97, 98, 111, 126, 128 } },
+		};
+
+		std::cout << ",\n  \"gomoku\": {\n"
+			<< "    \"budget_ms\": " << settings.gomoku << ",\n"
+			<< "    \"searches\": [\n";
+
+		for (size_t i{}; i < std::size(positions); ++i)
+		{
+			Gomoku grid;
+			for (const int square : positions[i][0])
+				grid.Play(square, Player::O);
+			for (const int square : positions[i][1])
+				grid.Play(square, Player::X);
+
+			Clock clock;
+			const Minimax::Result result{ Minimax::SearchFor(grid, Player::O, settings.gomoku) };
+			const float elapsed{ clock.Count() * 1000 };
+
+			std::cout << "      { \"elapsed_ms\": " << elapsed << ", \"depth\": " << result.depth
+				<< ", \"nodes\": " << result.nodes << ", \"move\": " << result.move << ", \"value\": " << result.value
+				<< " }" << (i + 1 < std::size(positions) ? ",\n" : "\n");
+		}
+
+		// Nos tabuleiros pequenos a busca termina antes do prazo e tem de dar o valor exato
+		constexpr int count{ 180 };
+		Random random{ settings.seed };
+
+		const int small{ Agreement<3, 3, 3>(random, count) };
+		const int wide{ Agreement<3, 4, 3>(random, count) };
+
+		std::cout << "    ],\n"
+			<< "    \"exact\": { \"3,3,3\": " << small << ", \"3,4,3\": " << wide << ", \"positions\": " << count << " }\n"
+			<< "  }";
+	}
+
+	// Iterações por segundo do MCTS paralelo, de 1 thread até o número de núcleos
+	void Scaling(const Settings& settings)
+	{
+		const int cores{ int(std::max(1u, std::thread::hardware_concurrency())) };
+		const float c{ 1 / std::sqrt(2.f) };
+
+		std::vector<int> counts;
+		for (int threads{ 1 }; threads < cores; threads *= 2)
+			counts.push_back(threads);
+		counts.push_back(cores);
+
+		float treeBase{}, rootBase{};
+
+		std::cout << ",\n  \"scaling\": [\n";
+
+		for (size_t i{}; i < counts.size(); ++i)
+		{
+			const int threads{ counts[i] };
+			MCTS::Tree tree;
+			tree.Seed(settings.seed);
+
+			Clock clock;
+			Board board;
+			tree.Search(board, settings.iterations, c, threads);
+			const float treeRate{ tree.Iterations() / clock.Count() };
+
+			clock.Reset();
+			board = Board{};
+			MCTS::RootParallelSearch(board, settings.iterations, c, threads);
+			const float rootRate{ settings.iterations / clock.Count() };
+
+			if (threads == 1)
+			{
+				treeBase = treeRate;
+				rootBase = rootRate;
+			}
+
+			std::cout << "    { \"threads\": " << threads
+				<< ", \"tree_iterations_per_sec\": " << treeRate << ", \"tree_speedup\": " << treeRate / treeBase
+				<< ", \"root_iterations_per_sec\": " << rootRate << ", \"root_speedup\": " << rootRate / rootBase
+				<< " }" << (i + 1 < counts.size() ? ",\n" : "\n");
+		}
+
+		std::cout << "  ]";
+	}
+}
+
+//--------------------------------------------------------------------------------------------------
+
+int main(int argc, char** argv)
+{
+	Settings settings;
+
+	// Uso: Benchmark [--seed N] [--iterations N] [--repeat N] [--rollouts N] [--rave k] [--rave-iterations N] [--scaling] [--gomoku ms]
+	for (int i{ 1 }; i < argc; ++i)
+	{
+		const std::string_view argument{ argv[i] };
+		const bool hasValue{ i + 1 < argc };
+
+		if (argument == "--seed" && hasValue)
+			settings.seed = uint32_t(std::strtoul(argv[++i], nullptr, 10));
+		else if (argument == "--iterations" && hasValue)
+			settings.iterations = std::max(1, std::atoi(argv[++i]));
+		else if (argument == "--repeat" && hasValue)
+			settings.repeat = std::max(1, std::atoi(argv[++i]));
+		else if (argument == "--rollouts" && hasValue)
+			settings.rollouts = std::max(1, std::atoi(argv[++i]));
+		else if (argument == "--rave" && hasValue)
+			settings.rave = std::max(0.f, float(std::atof(argv[++i])));
+		else if (argument == "--rave-iterations" && hasValue)
+			settings.raveIterations = std::max(1, std::atoi(argv[++i]));
+		else if (argument == "--scaling")
+			settings.scaling = true;
+		else if (argument == "--gomoku" && hasValue)
+			settings.gomoku = std::max(0.f, float(std::atof(argv[++i])));
+		else
+		{
+			std::cerr << "Uso: " << argv[0] << " [--seed N] [--iterations N] [--repeat N] [--rollouts N] [--rave k] [--rave-iterations N] [--scaling] [--gomoku ms]\n";
+			return 1;
+		}
+	}
+
+	// O RAVE roda com uma fração do orçamento, ao lado do MCTS completo, para comparar a qualidade
+	if (settings.raveIterations == 0)
+		settings.raveIterations = std::max(1, settings.iterations / 2);
+
+	const float c{ 1 / std::sqrt(2.f) };
+	Sample minimax, alphaBeta, mcts, rave, graph;
+
+	// Os motores são criados antes das medições para não contar a memória inicial
+	AlphaBeta search;
+	MCTS::Tree tree, raveTree;
+	tree.SetRollouts(settings.rollouts);
+	raveTree.SetRollouts(settings.rollouts);
+	raveTree.SetRave(settings.rave);
+	MCTS::Graph dag;
+	dag.SetRollouts(settings.rollouts);
+
+	// Aquecimento: cria os blocos da arena que as buscas medidas vão reutilizar
+	for (const auto position : suite)
+	{
+		for (const auto& [warm, iterations] : { std::pair{ &tree, settings.iterations }, std::pair{ &raveTree, settings.raveIterations } })
+		{
+			Board board{ Parse(position) };
+			warm->Clear();
+			warm->Search(board, iterations, c);
+		}
+
+		Board board{ Parse(position) };
+		dag.Clear();
+		dag.Search(board, settings.iterations, c);
+	}
+
+	for (int round{}; round < settings.repeat; ++round)
+	{
+		for (size_t i{}; i < std::size(suite); ++i)
+		{
+			const Board position{ Parse(suite[i]) };
+
+			// Consulta à tabela pré-calculada: um nó por busca
+			Measure(minimax, position, [&](Board& board) {
+				Minimax::Search(board);
+				return std::pair<uint64_t, uint64_t>{ 1, 0 };
+			});
+
+			// Cada busca começa com a tabela de transposição vazia
+			search.Clear();
+			Measure(alphaBeta, position, [&](Board& board) {
+				const auto result{ search.Search(board, Player::O) };
+				board.Set(result.move, Player::O);
+				return std::pair<uint64_t, uint64_t>{ result.nodes, 0 };
+			});
+
+			// Semente derivada da posição e da rodada: resultados reproduzíveis
+			const uint32_t seed{ settings.seed + uint32_t(round * std::size(suite) + i) };
+
+			tree.Clear();
+			tree.Seed(seed);
+			Measure(mcts, position, [&](Board& board) {
+				tree.Search(board, settings.iterations, c);
+				return std::pair<uint64_t, uint64_t>{ tree.Size(), uint64_t(tree.Iterations()) };
+			});
+
+			if (settings.rave > 0)
+			{
+				raveTree.Clear();
+				raveTree.Seed(seed);
+				Measure(rave, position, [&](Board& board) {
+					raveTree.Search(board, settings.raveIterations, c);
+					return std::pair<uint64_t, uint64_t>{ raveTree.Size(), uint64_t(raveTree.Iterations()) };
+				});
+			}
+
+			// Mesma busca sobre o grafo de transposições: uma posição, um nó
+			dag.Clear();
+			dag.Seed(seed);
+			Measure(graph, position, [&](Board& board) {
+				dag.Search(board, settings.iterations, c);
+				return std::pair<uint64_t, uint64_t>{ dag.Size(), uint64_t(dag.Iterations()) };
+			});
+		}
+	}
+
+	std::cout << "{\n"
+		<< "  \"seed\": " << settings.seed << ",\n"
+		<< "  \"iterations\": " << settings.iterations << ",\n"
+		<< "  \"repeat\": " << settings.repeat << ",\n"
+		<< "  \"rollouts\": " << settings.rollouts << ",\n"
+		<< "  \"policy\": \"" << RolloutPolicy::Name << "\",\n"
+		<< "  \"node_bytes\": " << sizeof(Node) << ",\n"
+		<< "  \"positions\": " << std::size(suite) << ",\n"
+		<< "  \"engines\": {\n";
+
+	Report("minimax", minimax, true);
+	Report("alphabeta", alphaBeta, false);
+	Report("mcts", mcts, false);
+
+	if (settings.rave > 0)
+		Report("mcts_rave", rave, false);
+
+	Report("mcts_graph", graph, false);
+
+	std::cout << "\n  }";
+
+	// Qualidade das jogadas do RAVE com o orçamento reduzido contra o MCTS com o orçamento completo
+	if (settings.rave > 0)
+	{
+		std::cout << ",\n  \"rave_comparison\": { \"mcts_iterations\": " << settings.iterations
+			<< ", \"mcts_optimal_moves\": " << double(mcts.optimal) / mcts.latencies.size()
+			<< ", \"rave_iterations\": " << settings.raveIterations
+			<< ", \"rave_optimal_moves\": " << double(rave.optimal) / rave.latencies.size() << " }";
+	}
+
+	Playouts(settings);
+	Grids(settings);
+
+	if (settings.scaling)
+		Scaling(settings);
+
+	if (settings.gomoku > 0)
+		Deepening(settings);
+
+	std::cout << "\n}\n";
+
+	// O laço do MCTS não deve alocar: a arena já foi criada no aquecimento
+	if (mcts.allocations || rave.allocations)
+	{
+		std::cerr << "MCTS fez " << mcts.allocations + rave.allocations << " alocacoes em " << mcts.iterations + rave.iterations << " iteracoes\n";
+		return 2;
+	}
+
+	return 0;
+}
+
+//--------------------------------------------------------------------------------------------------
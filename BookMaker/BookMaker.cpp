@@ -0,0 +1,100 @@
+#include "Book.h"
+#include "GameTable.h"
+#include "Clock.h"
+#include <iostream>
+#include <vector>
+#include <string_view>
+#include <unordered_set>
+#include <algorithm>
+#include <cstdlib>
+
+//--------------------------------------------------------------------------------------------------
+
+namespace
+{
+	struct Settings
+	{
+		int         plies{ 4 };            // Lances cobertos: posições com menos pedras que isso
+		const char* output{ "Book.bin" };
+	};
+
+	// Percorre as posições não terminais com menos de `plies` pedras, uma por classe de simetria
+	void Collect(Board& board, int plies, std::unordered_set<uint64_t>& visited, std::vector<Book::Entry>& entries)
+	{
+		if (board.CheckWinner() != Player::None || std::popcount(board.Available()) <= Board::Size - plies)
+			return;
+
+		const Book::Entry entry{ Book::MakeEntry(board, 0, 0) };
+
+		if (!visited.insert(entry.key).second)
+			return;
+
+		// Busca exaustiva: a tabela resolvida dá a jogada e o valor exatos
+		const Player player{ board.Turn() };
+		const GameTable::Entry solution{ GameTable::Lookup(board, player) };
+		entries.push_back(Book::MakeEntry(board, solution.move, solution.value));
+
+		for (Board::Mask moves{ board.DistinctMoves() }; moves; moves &= moves - 1)
+		{
+			const int move{ std::countr_zero(moves) };
+
+			board.MakeMove(move);
+			Collect(board, plies, visited, entries);
+			board.UnmakeMove();
+		}
+	}
+}
+
+//--------------------------------------------------------------------------------------------------
+
+int main(int argc, char** argv)
+{
+	Settings settings;
+
+	// Uso: BookMaker [--plies N] [--output arquivo]
+	for (int i{ 1 }; i < argc; ++i)
+	{
+		const std::string_view argument{ argv[i] };
+		const bool hasValue{ i + 1 < argc };
+
+		if (argument == "--plies" && hasValue)
+			settings.plies = std::clamp(std::atoi(argv[++i]), 1, Board::Size);
+		else if (argument == "--output" && hasValue)
+			settings.output = argv[++i];
+		else
+		{
+			std::cerr << "Uso: " << argv[0] << " [--plies N] [--output arquivo]\n";
+			return 1;
+		}
+	}
+
+	Clock clock;
+
+	Board board;
+	std::unordered_set<uint64_t> visited;
+	std::vector<Book::Entry> entries;
+	Collect(board, settings.plies, visited, entries);
+
+	if (!Book::Write(settings.output, entries))
+	{
+		std::cerr << "Erro ao gravar " << settings.output << '\n';
+		return 1;
+	}
+
+	// Confere o arquivo gravado abrindo-o como o jogo fará
+	Book book;
+
+	if (!book.Open(settings.output) || book.Size() != entries.size())
+	{
+		std::cerr << "Livro invalido: " << settings.output << '\n';
+		return 1;
+	}
+
+	std::cout << "{ \"output\": \"" << settings.output << "\", \"plies\": " << settings.plies
+		<< ", \"positions\": " << book.Size() << ", \"bytes\": " << sizeof(Book::Entry) * book.Size()
+		<< ", \"seconds\": " << clock.Count() << " }" << std::endl;
+
+	return 0;
+}
+
+//--------------------------------------------------------------------------------------------------
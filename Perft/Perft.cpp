@@ -0,0 +1,260 @@
+#include "Board.h"
+#include "Clock.h"
+#include <iostream>
+#include <thread>
+#include <vector>
+#include <string_view>
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+
+//--------------------------------------------------------------------------------------------------
+
+namespace
+{
+	struct Settings
+	{
+		int  depth{ Board::Size };  // Profundidade máxima (em lances)
+		int  threads{ int(std::max(1u, std::thread::hardware_concurrency())) };
+		int  hashBits{};            // log2 das entradas da tabela de transposição por thread (0 = sem tabela)
+		bool divide{};              // Mostra a contagem de cada primeira jogada
+	};
+
+	// Contagens de uma subárvore
+	struct Count
+	{
+		uint64_t leaves{};  // Posições exatamente na profundidade pedida (perft clássico)
+		uint64_t xWins{};   // Partidas terminadas até a profundidade, por resultado
+		uint64_t oWins{};
+		uint64_t draws{};
+
+		Count& operator+=(const Count& other)
+		{
+			leaves += other.leaves;
+			xWins += other.xWins;
+			oWins += other.oWins;
+			draws += other.draws;
+			return *this;
+		}
+
+		uint64_t Games() const
+		{
+			return xWins + oWins + draws;
+		}
+	};
+
+	// Partidas completas do 3x3 e seus resultados (X começa)
+	constexpr Count Complete{ 127872, 131184, 77904, 46080 };
+
+	// Subárvore a ser contada por uma das threads
+	struct Task
+	{
+		Board    board;
+		int      depth;
+		int      root;   // Primeira jogada que leva a esta subárvore
+		Count    count;
+		uint64_t nodes;
+	};
+
+	////////////////////////////////////////////////////////////
+	/// class Walker
+	/// \brief Percorre subárvores com GetAvailableMoves e
+	///        MakeMove/UnmakeMove como faz/desfaz.
+	///
+	/// Cada thread tem o seu, com a tabela de transposição
+	/// opcional indexada pelo hash de Zobrist que o próprio
+	/// tabuleiro atualiza a cada jogada.
+	///
+	////////////////////////////////////////////////////////////
+	class Walker
+	{
+	public:
+		explicit Walker(int hashBits) :
+			table(hashBits ? size_t(1) << hashBits : 0),
+			mask{ hashBits ? (uint64_t(1) << hashBits) - 1 : 0 }
+		{
+		}
+
+		Count Perft(Board& board, int depth, uint64_t& nodes)
+		{
+			nodes++;
+
+			Count count;
+
+			// Partida terminada antes ou na profundidade pedida
+			if (const Player winner{ board.CheckWinner() }; winner != Player::None || !board.Available())
+			{
+				count.leaves = depth == 0;
+				(winner == Player::X ? count.xWins : winner == Player::O ? count.oWins : count.draws) = 1;
+				return count;
+			}
+
+			if (depth == 0)
+			{
+				count.leaves = 1;
+				return count;
+			}
+
+			// Subárvores repetidas por transposição são contadas uma vez só
+			const uint64_t hash{ board.Hash() };
+			Entry* entry{ table.empty() ? nullptr : &table[hash & mask] };
+
+			if (entry && entry->key == hash && entry->depth == depth)
+				return entry->count;
+
+			// Lista de capacidade fixa na pilha: nenhuma alocação por nó
+			Board::MoveList moves;
+			board.GetAvailableMoves(moves);
+
+			for (const int move : moves)
+			{
+				board.MakeMove(move);
+				count += Perft(board, depth - 1, nodes);
+				board.UnmakeMove();
+			}
+
+			if (entry)
+				*entry = { hash, depth, count };
+
+			return count;
+		}
+
+	private:
+		struct Entry
+		{
+			uint64_t key;
+			int      depth;
+			Count    count;
+		};
+
+		std::vector<Entry> table;
+		uint64_t           mask;
+	};
+
+	// Expande os primeiros lances até haver subárvores suficientes para dividir entre as threads
+	void Split(Board& board, int depth, int split, int root, std::vector<Task>& tasks, uint64_t& nodes)
+	{
+		const Player winner{ board.CheckWinner() };
+
+		if (depth == 0 || split == 0 || winner != Player::None || !board.Available())
+		{
+			tasks.push_back({ board, depth, root, {}, 0 });
+			return;
+		}
+
+		nodes++;
+
+		for (Board::Mask moves{ board.Available() }; moves; moves &= moves - 1)
+		{
+			const int move{ std::countr_zero(moves) };
+
+			board.MakeMove(move);
+			Split(board, depth - 1, split - 1, root < 0 ? move : root, tasks, nodes);
+			board.UnmakeMove();
+		}
+	}
+}
+
+//--------------------------------------------------------------------------------------------------
+
+int main(int argc, char** argv)
+{
+	Settings settings;
+
+	// Uso: Perft [--depth N] [--threads N] [--hash bits] [--divide]
+	for (int i{ 1 }; i < argc; ++i)
+	{
+		const std::string_view argument{ argv[i] };
+		const bool hasValue{ i + 1 < argc };
+
+		if (argument == "--depth" && hasValue)
+			settings.depth = std::clamp(std::atoi(argv[++i]), 0, Board::Size);
+		else if (argument == "--threads" && hasValue)
+			settings.threads = std::max(1, std::atoi(argv[++i]));
+		else if (argument == "--hash" && hasValue)
+			settings.hashBits = std::clamp(std::atoi(argv[++i]), 0, 28);
+		else if (argument == "--divide")
+			settings.divide = true;
+		else
+		{
+			std::cerr << "Uso: " << argv[0] << " [--depth N] [--threads N] [--hash bits] [--divide]\n";
+			return 1;
+		}
+	}
+
+	bool valid{ true };
+
+	for (int depth{ 1 }; depth <= settings.depth; ++depth)
+	{
+		Clock clock;
+
+		// Dois lances de divisão dão 72 subárvores, o bastante para balancear as threads
+		Board board;
+		std::vector<Task> tasks;
+		Count count;
+		uint64_t nodes{};
+		Split(board, depth, 2, -1, tasks, nodes);
+
+		std::atomic<size_t> next{};
+		std::vector<std::thread> workers;
+
+		for (int t{}; t < settings.threads; ++t)
+		{
+			workers.emplace_back([&] {
+				Walker walker{ settings.hashBits };
+
+				for (size_t index; (index = next.fetch_add(1, std::memory_order_relaxed)) < tasks.size();)
+				{
+					Task& task{ tasks[index] };
+					task.count = walker.Perft(task.board, task.depth, task.nodes);
+				}
+			});
+		}
+
+		for (auto& worker : workers)
+			worker.join();
+
+		std::array<Count, Board::Size> divide{};
+
+		for (const Task& task : tasks)
+		{
+			count += task.count;
+			nodes += task.nodes;
+
+			if (task.root >= 0)
+				divide[task.root] += task.count;
+		}
+
+		const float seconds{ clock.Count() };
+
+		std::cout << "{ \"depth\": " << depth << ", \"leaves\": " << count.leaves << ", \"games\": " << count.Games()
+			<< ", \"x_wins\": " << count.xWins << ", \"o_wins\": " << count.oWins << ", \"draws\": " << count.draws
+			<< ", \"nodes\": " << nodes << ", \"threads\": " << settings.threads << ", \"hashed\": " << (settings.hashBits ? "true" : "false")
+			<< ", \"seconds\": " << seconds << ", \"nodes_per_sec\": " << nodes / std::max(seconds, 1e-9f);
+
+		if (settings.divide)
+		{
+			std::cout << ", \"divide\": {";
+			for (int move{}; move < Board::Size; ++move)
+				std::cout << (move ? ", " : " ") << '"' << move << "\": " << divide[move].leaves;
+			std::cout << " }";
+		}
+
+		std::cout << " }" << std::endl;
+
+		// Na profundidade completa, toda partida do 3x3 terminou: os totais são conhecidos
+		if (depth == Board::Size && (count.leaves != Complete.leaves || count.xWins != Complete.xWins ||
+			count.oWins != Complete.oWins || count.draws != Complete.draws))
+			valid = false;
+	}
+
+	if (!valid)
+	{
+		std::cerr << "Contagem divergente: esperadas " << Complete.Games() << " partidas completas\n";
+		return 2;
+	}
+
+	return 0;
+}
+
+//--------------------------------------------------------------------------------------------------
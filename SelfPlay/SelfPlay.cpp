@@ -0,0 +1,282 @@
+#include "MCTS.h"
+#include "Minimax.h"
+#include "Clock.h"
+#include <iostream>
+#include <thread>
+#include <vector>
+#include <string>
+#include <string_view>
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <cstdlib>
+#include <cmath>
+
+//--------------------------------------------------------------------------------------------------
+
+namespace
+{
+	// Motor configurado pela linha de comando: "minimax", "random" ou "mcts[:iterações[:c[:k]]]"
+	struct Engine
+	{
+		enum Kind
+		{
+			Minimax,
+			Random,
+			MCTS,
+		};
+
+		Kind        kind{ Random };
+		int         iterations{ 1000 };
+		float       explorationConstant{ 1 / std::sqrt(2.f) };
+		float       rave{};  // Parâmetro k do RAVE (0 = desligado)
+		std::string name;
+	};
+
+	struct Settings
+	{
+		Engine   engines[2];
+		uint64_t games{ 10000 };
+		int      threads{ int(std::max(1u, std::thread::hardware_concurrency())) };
+		uint32_t seed{ 1 };
+		float    interval{ 1.f };  // Segundos entre relatórios
+	};
+
+	// Resultados da perspectiva do primeiro motor
+	struct Tally
+	{
+		std::atomic<uint64_t> wins{};
+		std::atomic<uint64_t> draws{};
+		std::atomic<uint64_t> losses{};
+	};
+
+	bool Parse(std::string_view spec, Engine& engine)
+	{
+		engine.name = spec;
+
+		if (spec == "minimax")
+			engine.kind = Engine::Minimax;
+		else if (spec == "random")
+			engine.kind = Engine::Random;
+		else if (spec.starts_with("mcts"))
+		{
+			engine.kind = Engine::MCTS;
+
+			// Parâmetros opcionais separados por ':'
+			std::string text{ spec };
+			char* cursor{ text.data() + 4 };
+
+			if (*cursor == ':')
+			{
+				engine.iterations = std::max(1, int(std::strtol(cursor + 1, &cursor, 10)));
+
+				if (*cursor == ':')
+					engine.explorationConstant = std::strtof(cursor + 1, &cursor);
+
+				if (*cursor == ':')
+					engine.rave = std::max(0.f, std::strtof(cursor + 1, &cursor));
+			}
+
+			return *cursor == '\0';
+		}
+		else
+			return false;
+
+		return true;
+	}
+
+	// Estado de um motor dentro de uma thread (árvore e gerador próprios)
+	class Contestant
+	{
+	public:
+		Contestant(const Engine& engine, uint32_t seed) :
+			engine{ engine },
+			random{ seed }
+		{
+			if (engine.kind == Engine::MCTS)
+			{
+				tree = std::make_unique<MCTS::Tree>();
+				tree->Seed(seed);
+				tree->SetRave(engine.rave);
+			}
+		}
+
+		void Move(Board& board)
+		{
+			switch (engine.kind)
+			{
+			case Engine::Minimax:
+				Minimax::Search(board);
+				break;
+
+			case Engine::MCTS:
+				tree->Search(board, engine.iterations, engine.explorationConstant);
+				break;
+
+			case Engine::Random:
+			{
+				// Sorteio uniforme entre as casas livres
+				const Board::Mask available{ board.Available() };
+				Board::Mask moves{ available };
+				for (uint32_t skip{ random.Below(uint32_t(std::popcount(available))) }; skip > 0; --skip)
+					moves &= moves - 1;
+
+				board.MakeMove(std::countr_zero(moves));
+				break;
+			}
+			}
+		}
+
+	private:
+		const Engine&               engine;
+		Random                      random;
+		std::unique_ptr<MCTS::Tree> tree;
+	};
+
+	// Joga uma partida e retorna o vencedor
+	Player Play(Contestant& x, Contestant& o)
+	{
+		Board board;
+		Player winner{};
+
+		// Termina assim que nenhuma linha puder mais ser completada
+		while ((winner = board.CheckWinner()) == Player::None && !board.IsDeadDraw())
+			(board.Turn() == Player::X ? x : o).Move(board);
+
+		return winner;
+	}
+
+	// Diferença de Elo correspondente a uma pontuação média
+	double Elo(double score)
+	{
+		return 400 * std::log10(score / (1 - score));
+	}
+
+	void Report(const Tally& tally, double seconds, bool final)
+	{
+		const uint64_t wins{ tally.wins }, draws{ tally.draws }, losses{ tally.losses };
+		const uint64_t games{ wins + draws + losses };
+
+		std::cout << "{ \"games\": " << games << ", \"wins\": " << wins << ", \"draws\": " << draws << ", \"losses\": " << losses;
+
+		if (games)
+		{
+			// Pontuação média e intervalo de 95% pelo erro padrão da média
+			const double score{ (wins + 0.5 * draws) / games };
+			const double variance{ (wins * (1 - score) * (1 - score) + draws * (0.5 - score) * (0.5 - score) + losses * score * score) / games };
+			const double margin{ 1.96 * std::sqrt(variance / games) };
+
+			// Elo indefinido quando a pontuação é 0 ou 1
+			auto print{ [](double score) {
+				if (score <= 0 || score >= 1)
+					std::cout << "null";
+				else
+					std::cout << Elo(score);
+			} };
+
+			std::cout << ", \"score\": " << score << ", \"elo\": ";
+			print(score);
+			std::cout << ", \"elo_low\": ";
+			print(score - margin);
+			std::cout << ", \"elo_high\": ";
+			print(score + margin);
+		}
+
+		std::cout << ", \"games_per_sec\": " << games / std::max(seconds, 1e-9)
+			<< ", \"final\": " << (final ? "true" : "false") << " }" << std::endl;
+	}
+}
+
+//--------------------------------------------------------------------------------------------------
+
+int main(int argc, char** argv)
+{
+	Settings settings;
+	int engines{};
+
+	// Uso: SelfPlay [--games N] [--threads N] [--seed N] [--interval s] motorA motorB
+	for (int i{ 1 }; i < argc; ++i)
+	{
+		const std::string_view argument{ argv[i] };
+		const bool hasValue{ i + 1 < argc };
+
+		if (argument == "--games" && hasValue)
+			settings.games = std::strtoull(argv[++i], nullptr, 10);
+		else if (argument == "--threads" && hasValue)
+			settings.threads = std::max(1, std::atoi(argv[++i]));
+		else if (argument == "--seed" && hasValue)
+			settings.seed = uint32_t(std::strtoul(argv[++i], nullptr, 10));
+		else if (argument == "--interval" && hasValue)
+			settings.interval = std::max(0.01f, float(std::atof(argv[++i])));
+		else if (engines < 2 && Parse(argument, settings.engines[engines]))
+			engines++;
+		else
+			engines = -1;
+
+		if (engines < 0)
+			break;
+	}
+
+	if (engines != 2)
+	{
+		std::cerr << "Uso: " << argv[0] << " [--games N] [--threads N] [--seed N] [--interval s] motorA motorB\n"
+			<< "Motores: minimax, random, mcts[:iteracoes[:c[:k]]]\n";
+		return 1;
+	}
+
+	std::cerr << settings.engines[0].name << " vs " << settings.engines[1].name << ", "
+		<< settings.games << " partidas em " << settings.threads << " threads\n";
+
+	Tally tally;
+	std::atomic<uint64_t> next{};
+	std::atomic<int> running{ settings.threads };
+	std::vector<std::thread> workers;
+
+	Clock clock;
+
+	for (int t{}; t < settings.threads; ++t)
+	{
+		workers.emplace_back([&, t] {
+			// Cada thread tem seus próprios motores e geradores
+			const uint32_t seed{ settings.seed + 2 * uint32_t(t) };
+			Contestant first{ settings.engines[0], seed }, second{ settings.engines[1], seed + 1 };
+
+			for (uint64_t game; (game = next.fetch_add(1, std::memory_order_relaxed)) < settings.games;)
+			{
+				// As cores alternam a cada partida; X sempre começa
+				const bool firstIsX{ game % 2 == 0 };
+				const Player winner{ firstIsX ? Play(first, second) : Play(second, first) };
+
+				if (winner == Player::None)
+					tally.draws.fetch_add(1, std::memory_order_relaxed);
+				else if ((winner == Player::X) == firstIsX)
+					tally.wins.fetch_add(1, std::memory_order_relaxed);
+				else
+					tally.losses.fetch_add(1, std::memory_order_relaxed);
+			}
+
+			running.fetch_sub(1, std::memory_order_release);
+		});
+	}
+
+	// Relatórios parciais enquanto as partidas são jogadas
+	for (float last{}; running.load(std::memory_order_acquire) > 0;)
+	{
+		std::this_thread::sleep_for(milliseconds(10));
+
+		if (const float elapsed{ clock.Count() }; elapsed - last >= settings.interval)
+		{
+			Report(tally, elapsed, false);
+			last = elapsed;
+		}
+	}
+
+	for (auto& worker : workers)
+		worker.join();
+
+	Report(tally, clock.Count(), true);
+
+	return 0;
+}
+
+//--------------------------------------------------------------------------------------------------
@@ -0,0 +1,197 @@
+#include "Tablebase.h"
+#include "Clock.h"
+#include <iostream>
+#include <vector>
+#include <string_view>
+#include <algorithm>
+
+//--------------------------------------------------------------------------------------------------
+
+namespace
+{
+	using Mask = Tablebase::Mask;
+
+	// Resultado em construção: valor nos 2 bits baixos, lances até o fim nos demais
+	constexpr uint8_t Pack(Tablebase::Value value, int distance)
+	{
+		return uint8_t(value | distance << 2);
+	}
+
+	constexpr Tablebase::Value ValueOf(uint8_t result)
+	{
+		return Tablebase::Value(result & 3);
+	}
+
+	constexpr int DistanceOf(uint8_t result)
+	{
+		return result >> 2;
+	}
+
+	//----------------------------------------------------------------------------------------------
+
+	// Próxima máscara de 16 bits com o mesmo número de bits ligados (Gosper); 0 ao acabar
+	Mask Next(Mask mask)
+	{
+		const uint32_t value{ mask };
+		const uint32_t lowest{ value & (0u - value) };
+		const uint32_t ripple{ value + lowest };
+		const uint32_t next{ ripple | (((value ^ ripple) >> 2) / lowest) };
+
+		return next >> Tablebase::Size ? 0 : Mask(next);
+	}
+
+	//----------------------------------------------------------------------------------------------
+
+	// Chama `function` para cada máscara de 16 bits com `count` bits ligados, em ordem crescente
+	template <typename Function>
+	void ForEachMask(int count, Function function)
+	{
+		Mask mask{ Mask((1 << count) - 1) };
+
+		do
+			function(mask);
+		while (count > 0 && (mask = Next(mask)));
+	}
+
+	//----------------------------------------------------------------------------------------------
+
+	// Valor de uma posição a partir dos filhos, já resolvidos na camada seguinte
+	uint8_t Solve(Mask x, Mask o, bool xToMove, const std::vector<uint8_t>& results)
+	{
+		const Mask mover{ xToMove ? x : o }, other{ xToMove ? o : x };
+
+		// Quem joga já tinha vencido: a partida teria terminado antes
+		if (Tablebase::HasLine(mover))
+			return Pack(Tablebase::Illegal, 0);
+
+		if (Tablebase::HasLine(other))
+			return Pack(Tablebase::Loss, 0);
+
+		const Mask empty{ Mask(~(x | o)) };
+
+		if (!empty)
+			return Pack(Tablebase::Draw, 0);
+
+		// Vitória mais rápida, empate, ou a derrota mais demorada
+		int win{ Tablebase::Size + 1 }, loss{ -1 };
+		bool draw{};
+
+		for (Mask moves{ empty }; moves; moves &= moves - 1)
+		{
+			const Mask bit{ Mask(moves & -moves) };
+			const uint8_t child{ results[xToMove ? Tablebase::Rank(x | bit, o) : Tablebase::Rank(x, o | bit)] };
+
+			switch (ValueOf(child))
+			{
+			case Tablebase::Loss:
+				win = std::min(win, DistanceOf(child) + 1);
+				break;
+
+			case Tablebase::Draw:
+				draw = true;
+				break;
+
+			default:
+				loss = std::max(loss, DistanceOf(child) + 1);
+				break;
+			}
+		}
+
+		if (win <= Tablebase::Size)
+			return Pack(Tablebase::Win, win);
+
+		if (draw)
+			return Pack(Tablebase::Draw, 0);
+
+		return Pack(Tablebase::Loss, loss);
+	}
+}
+
+//--------------------------------------------------------------------------------------------------
+
+int main(int argc, char** argv)
+{
+	const char* output{ "Tablebase.bin" };
+
+	// Uso: TablebaseMaker [--output arquivo]
+	for (int i{ 1 }; i < argc; ++i)
+	{
+		if (std::string_view{ argv[i] } == "--output" && i + 1 < argc)
+			output = argv[++i];
+		else
+		{
+			std::cerr << "Uso: " << argv[0] << " [--output arquivo]\n";
+			return 1;
+		}
+	}
+
+	Clock clock;
+
+	std::vector<uint8_t> results(Tablebase::Positions);
+	uint64_t canonical{}, legal{}, counts[4]{};
+	int longest{};
+
+	// Análise retrógrada por camadas: do tabuleiro cheio até o vazio, pois cada jogada acrescenta uma pedra
+	for (int stones{ Tablebase::Size }; stones >= 0; --stones)
+	{
+		const int countX{ (stones + 1) / 2 }, countO{ stones / 2 };
+		const bool xToMove{ countX == countO };
+
+		ForEachMask(countX, [&](Mask x) {
+			ForEachMask(countO, [&](Mask o) {
+				if (x & o)
+					return;
+
+				// Resolve só a forma canônica (menor codificação) e copia o resultado para as imagens
+				const uint32_t code{ uint32_t(x) << 16 | o };
+
+				for (int symmetry{ 1 }; symmetry < Tablebase::Symmetries; ++symmetry)
+				{
+					if ((uint32_t(Tablebase::Transform(x, symmetry)) << 16 | Tablebase::Transform(o, symmetry)) < code)
+						return;
+				}
+
+				const uint8_t result{ Solve(x, o, xToMove, results) };
+
+				for (int symmetry{}; symmetry < Tablebase::Symmetries; ++symmetry)
+					results[Tablebase::Rank(Tablebase::Transform(x, symmetry), Tablebase::Transform(o, symmetry))] = result;
+
+				canonical++;
+				counts[ValueOf(result)]++;
+
+				if (ValueOf(result) != Tablebase::Illegal)
+				{
+					legal++;
+					longest = std::max(longest, DistanceOf(result));
+				}
+			});
+		});
+	}
+
+	if (!Tablebase::Write(output, results))
+	{
+		std::cerr << "Erro ao gravar " << output << '\n';
+		return 1;
+	}
+
+	// Confere o arquivo gravado abrindo-o como o motor fará
+	Tablebase tablebase;
+
+	if (!tablebase.Open(output))
+	{
+		std::cerr << "Tabela invalida: " << output << '\n';
+		return 1;
+	}
+
+	const char* names[]{ "illegal", "loss", "draw", "win" };
+	const uint8_t root{ results[Tablebase::Rank(0, 0)] };
+
+	std::cout << "{ \"output\": \"" << output << "\", \"positions\": " << Tablebase::Positions
+		<< ", \"bytes\": " << (Tablebase::Positions + 3) / 4 << ", \"canonical\": " << canonical << ", \"legal\": " << legal
+		<< ", \"wins\": " << counts[Tablebase::Win] << ", \"draws\": " << counts[Tablebase::Draw] << ", \"losses\": " << counts[Tablebase::Loss]
+		<< ", \"longest\": " << longest << ", \"root\": \"" << names[ValueOf(root)] << "\", \"seconds\": " << clock.Count() << " }" << std::endl;
+
+	return 0;
+}
+
+//--------------------------------------------------------------------------------------------------
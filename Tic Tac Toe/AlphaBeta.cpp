@@ -0,0 +1,225 @@
+#include "AlphaBeta.h"
+#include <algorithm>
+#include <limits>
+
+//--------------------------------------------------------------------------------------------------
+
+AlphaBeta::AlphaBeta(int tableBits) :
+    table(size_t(1) << tableBits),
+    mask{ (uint64_t(1) << tableBits) - 1 },
+    killers{},
+    history{},
+    rootMove{ -1 },
+    nodes{}
+{
+    Clear();
+}
+
+//--------------------------------------------------------------------------------------------------
+
+AlphaBeta::Result AlphaBeta::Search(Board& board, Player player)
+{
+    // Killers valem apenas para uma busca; o histórico envelhece entre buscas
+    for (auto& moves : killers)
+        moves.fill(-1);
+
+    for (auto& scores : history)
+        for (auto& score : scores)
+            score >>= 1;
+
+    nodes = 0;
+    rootMove = -1;
+
+    // Em 3x3 a busca sempre chega aos estados terminais
+    const int depth{ std::popcount(board.Available()) };
+    Board::Hashes hashes{ board.SymmetricHashes() };
+
+    if (player == Player::X)
+    {
+        for (auto& hash : hashes)
+            hash ^= Board::SideKey();
+    }
+
+    const int value{ Negamax(board, player, hashes, depth, 0, -Win - 1, Win + 1) };
+
+    return { rootMove, value, nodes };
+}
+
+//--------------------------------------------------------------------------------------------------
+
+void AlphaBeta::Clear()
+{
+    std::fill(table.begin(), table.end(), Entry{ 0, 0, -1, 0, Exact });
+}
+
+//--------------------------------------------------------------------------------------------------
+
+int AlphaBeta::Negamax(Board& board, Player player, const Board::Hashes& hashes, int depth, int ply, int alpha, int beta)
+{
+    nodes++;
+
+    // Se o adversário venceu (estado terminal), retorna derrota descontada pela distância
+    if (board.CheckWinner() != Player::None)
+        return ply - Win;
+
+    const Board::Mask available{ board.Available() };
+
+    // Se há empate (terminal ou decidido abaixo da raiz) ou a profundidade acabou, retorna utilidade
+    if (available == 0 || depth == 0 || (ply > 0 && board.IsDeadDraw()))
+        return 0;
+
+    // Consulta a tabela de transposição pela forma canônica (jogadas ficam no referencial canônico)
+    int symmetry;
+    const uint64_t key{ Board::CanonicalKey(hashes, symmetry) };
+    const int originalAlpha{ alpha };
+    Entry& entry{ table[key & mask] };
+    int ttMove{ -1 };
+
+    if (entry.key == key)
+    {
+        if (entry.move >= 0)
+            ttMove = Board::InverseSquare(entry.move, symmetry);
+
+        if (entry.depth >= depth)
+        {
+            const int value{ FromTable(entry.value, ply) };
+
+            if (entry.bound == Exact)
+            {
+                if (ply == 0)
+                    rootMove = ttMove;
+                return value;
+            }
+
+            if (entry.bound == Lower)
+                alpha = std::max(alpha, value);
+            else
+                beta = std::min(beta, value);
+
+            if (alpha >= beta)
+            {
+                if (ply == 0)
+                    rootMove = ttMove;
+                return value;
+            }
+        }
+    }
+
+    // Ordena as jogadas: tabela, killers, histórico e centralidade
+    std::array<int, Board::Size> moves;
+    OrderMoves(available, player, ply, ttMove, moves);
+
+    int bestValue{ std::numeric_limits<int>::min() };
+    int bestMove{ -1 };
+
+    for (int i{}, count{ std::popcount(available) }; i < count; ++i)
+    {
+        const int move{ moves[i] };
+
+        // Faz a jogada, atualizando os hashes incrementalmente
+        Board::Hashes next{ hashes };
+        Board::Toggle(next, move, player);
+
+        for (auto& hash : next)
+            hash ^= Board::SideKey();
+
+        board.MakeMove(move);
+        const int value{ -Negamax(board, Player(-player), next, depth - 1, ply + 1, -beta, -alpha) };
+        board.UnmakeMove();
+
+        if (value > bestValue)
+        {
+            bestValue = value;
+            bestMove = move;
+        }
+
+        alpha = std::max(alpha, value);
+
+        // Corte beta: registra killer e histórico da jogada
+        if (alpha >= beta)
+        {
+            auto& killer{ killers[ply] };
+            if (killer[0] != move)
+            {
+                killer[1] = killer[0];
+                killer[0] = move;
+            }
+
+            history[player == Player::X][move] += depth * depth;
+            break;
+        }
+    }
+
+    // Armazena o resultado com o tipo de limite correspondente
+    const Bound bound{ bestValue <= originalAlpha ? Upper : bestValue >= beta ? Lower : Exact };
+    const int8_t canonicalMove{ int8_t(bestMove >= 0 ? Board::TransformSquare(bestMove, symmetry) : -1) };
+    entry = { key, int16_t(ToTable(bestValue, ply)), canonicalMove, uint8_t(depth), bound };
+
+    if (ply == 0)
+        rootMove = bestMove;
+
+    return bestValue;
+}
+
+//--------------------------------------------------------------------------------------------------
+
+void AlphaBeta::OrderMoves(Board::Mask available, Player player, int ply, int ttMove, std::array<int, Board::Size>& moves) const
+{
+    std::array<uint32_t, Board::Size> scores;
+    int count{};
+
+    for (; available; available &= available - 1)
+    {
+        const int move{ std::countr_zero(available) };
+
+        // Centro e cantos primeiro (mais linhas passam por eles), depois killers e histórico
+        uint32_t score{ uint32_t(Board::LinesThrough(move)) + history[player == Player::X][move] };
+
+        if (move == ttMove)
+            score = std::numeric_limits<uint32_t>::max();
+        else if (move == killers[ply][0])
+            score += 1 << 24;
+        else if (move == killers[ply][1])
+            score += 1 << 23;
+
+        // Ordenação por inserção (no máximo 9 jogadas)
+        int i{ count++ };
+        for (; i > 0 && scores[i - 1] < score; --i)
+        {
+            scores[i] = scores[i - 1];
+            moves[i] = moves[i - 1];
+        }
+
+        scores[i] = score;
+        moves[i] = move;
+    }
+}
+
+//--------------------------------------------------------------------------------------------------
+
+int AlphaBeta::ToTable(int value, int ply)
+{
+    // Vitórias são armazenadas relativas ao nó, não à raiz
+    if (value >= Win - Board::Size)
+        return value + ply;
+
+    if (value <= Board::Size - Win)
+        return value - ply;
+
+    return value;
+}
+
+//--------------------------------------------------------------------------------------------------
+
+int AlphaBeta::FromTable(int value, int ply)
+{
+    if (value >= Win - Board::Size)
+        return value - ply;
+
+    if (value <= Board::Size - Win)
+        return value + ply;
+
+    return value;
+}
+
+//--------------------------------------------------------------------------------------------------
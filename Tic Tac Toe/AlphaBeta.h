@@ -0,0 +1,62 @@
+#ifndef QUANTVERSO_ALPHABETA_H
+#define QUANTVERSO_ALPHABETA_H
+
+//--------------------------------------------------------------------------------------------------
+
+#include "Board.h"
+#include <vector>
+
+//--------------------------------------------------------------------------------------------------
+
+class AlphaBeta
+{
+public:
+    struct Result
+    {
+        int      move;  // Melhor jogada (-1 em posições terminais)
+        int      value; // Utilidade para o jogador da vez
+        uint64_t nodes; // Nós visitados na busca
+    };
+
+    static constexpr int Win{ 1000 };
+
+    explicit AlphaBeta(int tableBits = 16);
+
+    // `player` é o jogador da vez (board.Turn()); as jogadas são feitas com MakeMove
+    Result Search(Board& board, Player player);
+    void Clear();
+
+private:
+    enum Bound : uint8_t
+    {
+        Exact,
+        Lower,
+        Upper,
+    };
+
+    struct Entry
+    {
+        uint64_t key;
+        int16_t  value;
+        int8_t   move;
+        uint8_t  depth;
+        Bound    bound;
+    };
+
+    int Negamax(Board& board, Player player, const Board::Hashes& hashes, int depth, int ply, int alpha, int beta);
+    void OrderMoves(Board::Mask available, Player player, int ply, int ttMove, std::array<int, Board::Size>& moves) const;
+
+    static int ToTable(int value, int ply);
+    static int FromTable(int value, int ply);
+
+    std::vector<Entry>                               table;
+    uint64_t                                         mask;
+    std::array<std::array<int, 2>, Board::Size + 1>  killers;
+    std::array<std::array<uint32_t, Board::Size>, 2> history;
+    int                                              rootMove;
+    uint64_t                                         nodes;
+};
+
+//--------------------------------------------------------------------------------------------------
+
+#endif
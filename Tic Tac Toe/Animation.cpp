@@ -48,7 +48,7 @@ bool Animation::Run(unsigned id, float frameTime)
             selected = &sequence->second;
             currentId = id;
 
-            // Se for s um quadro, definio ocorre somente uma vez
+            // Se for só um quadro, definição ocorre somente uma vez
             if (selected->sequence.size() == 1)
             {
                 entity->material.Rect(selected->sequence[0]);
@@ -56,7 +56,7 @@ bool Animation::Run(unsigned id, float frameTime)
                 return false;
             }
 
-            // Reinicia o ndice dependendo da continuidade da animao
+            // Reinicia o índice dependendo da continuidade da animação
             if (!selected->continuous || selected->sequence.size() <= lastIndex)
                 index = 0;
             else
@@ -79,17 +79,17 @@ bool Animation::Run(unsigned id, float frameTime)
         {
             if (index >= selected->sequence.size())
             {
-                if (selected->loop) // Reseta o indce se estiver em loop
+                if (selected->loop) // Reseta o indíce se estiver em loop
                     index = 0;
                 else
-                    return true; // Retorna true se no estiver em loop e chegar ao ltimo quadro
+                    return true; // Retorna true se não estiver em loop e chegar ao último quadro
             }
 
             if (index < selected->sequence.size())
             {
                 entity->material.Rect(selected->sequence[index++]);
 
-                // Salva o ltimo ndice se a animao for contnua
+                // Salva o último índice se a animação for contínua
                 if (selected->continuous)
                     lastIndex = index;
 
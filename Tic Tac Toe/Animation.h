@@ -10,12 +10,12 @@
 
 ////////////////////////////////////////////////////////////
 /// \class Animation
-/// \brief Classe responsvel por gerenciar animaes para uma entidade.
+/// \brief Classe responsável por gerenciar animações para uma entidade.
 /// 
-/// A classe Animation permite a criao, adio e execuo de animaes
-/// baseadas em uma sequncia de retngulos de textura (frames).
-/// As animaes podem ser contnuas (para movimentos de personagens por exemplo)
-/// ou incontnuas (para animaes independentes de outras animaes).
+/// A classe Animation permite a criação, adição e execução de animações
+/// baseadas em uma sequência de retângulos de textura (frames).
+/// As animações podem ser contínuas (para movimentos de personagens por exemplo)
+/// ou incontínuas (para animações independentes de outras animações).
 ///
 ////////////////////////////////////////////////////////////
 class Animation : public Component
@@ -25,9 +25,9 @@ public:
     /// \brief Construtor da classe Animation.
     /// 
     /// Este construtor carrega uma textura a partir de um arquivo e
-    /// associa  entidade a qual a animao pertence.
+    /// associa à entidade a qual a animação pertence.
     /// 
-    /// \param entity Ponteiro para a entidade dona da animao.
+    /// \param entity Ponteiro para a entidade dona da animação.
     /// \param fileName Caminho para o arquivo de textura a ser carregado.
     /// 
     ////////////////////////////////////////////////////////////
@@ -36,47 +36,47 @@ public:
     ////////////////////////////////////////////////////////////
     /// \brief Construtor da classe Animation usando uma textura existente.
     /// 
-    /// Associa uma textura j existente a uma animao da entidade.
+    /// Associa uma textura já existente a uma animação da entidade.
     /// 
-    /// \param entity Ponteiro para a entidade dona da animao.
-    /// \param tileSet Referncia para uma textura j carregada.
+    /// \param entity Ponteiro para a entidade dona da animação.
+    /// \param tileSet Referência para uma textura já carregada.
     /// 
     ////////////////////////////////////////////////////////////
     Animation(Entity* entity, Texture* tileSet);
 
     ////////////////////////////////////////////////////////////
-    /// \brief Adiciona uma nova animao  lista de animaes.
+    /// \brief Adiciona uma nova animação à lista de animações.
     ///
-    /// Associa um ID a uma sequncia de quadros (IntRect) que definem a
-    /// animao. A animao pode ser contnua ou no.
+    /// Associa um ID a uma sequência de quadros (IntRect) que definem a
+    /// animação. A animação pode ser contínua ou não.
     /// 
-    /// \param id ID nico para a animao.
-    /// \param sequence Vetor de coordenadas de retngulos de textura que representam os frames.
-    /// \param loop Define se a animao deve rodar em loop.
-    /// \param continuous Define se a animao deve continuar do mesmo ndice ao mudar de ID.
+    /// \param id ID único para a animação.
+    /// \param sequence Vetor de coordenadas de retângulos de textura que representam os frames.
+    /// \param loop Define se a animação deve rodar em loop.
+    /// \param continuous Define se a animação deve continuar do mesmo índice ao mudar de ID.
     /// 
     ////////////////////////////////////////////////////////////
     void Add(unsigned id, std::vector<Rect> sequence, bool loop, bool continuous);
 
     ////////////////////////////////////////////////////////////
-    /// \brief Adiciona um quadro  lista de animaes.
+    /// \brief Adiciona um quadro à lista de animações.
     ///
-    /// Associa um ID a um quadro (IntRect) que define a animao.
+    /// Associa um ID a um quadro (IntRect) que define a animação.
     /// 
-    /// \param id ID nico para a animao.
-    /// \param sequence Coordenadas do retngulo da textura que representa o frame.
+    /// \param id ID único para a animação.
+    /// \param sequence Coordenadas do retângulo da textura que representa o frame.
     /// 
     ////////////////////////////////////////////////////////////
     void Add(unsigned id, Rect sequence);
 
     ////////////////////////////////////////////////////////////
-    /// \brief Executa uma animao baseada no ID fornecido.
+    /// \brief Executa uma animação baseada no ID fornecido.
     /// 
-    /// Controla o fluxo da animao, alterando os quadros com base no tempo de frame.
+    /// Controla o fluxo da animação, alterando os quadros com base no tempo de frame.
     ///
-    /// \param id ID da animao a ser executada.
-    /// \param frameTime Tempo entre os quadros, em milissegundos. O padro  0.
-    /// \return Retorna true se a animao no estiver em loop e chegar ao ltimo quadro.
+    /// \param id ID da animação a ser executada.
+    /// \param frameTime Tempo entre os quadros, em milissegundos. O padrão é 0.
+    /// \return Retorna true se a animação não estiver em loop e chegar ao último quadro.
     /// 
     ////////////////////////////////////////////////////////////
     bool Run(unsigned id, float frameTime);
@@ -84,26 +84,26 @@ public:
 private:
     ////////////////////////////////////////////////////////////
     /// \struct RectCoords
-    /// \brief Estrutura que armazena a sequncia de frames e o estado de uma animao.
+    /// \brief Estrutura que armazena a sequência de frames e o estado de uma animação.
     /// 
     ////////////////////////////////////////////////////////////
     struct RectCoords
     {
-        std::vector<Rect> sequence;     ///< Vetor de coodenadas de retngulos que representam os quadros.
-        bool              continuous{}; ///< Define se a animao  contnua.
-        bool              loop{};       ///< Define se a animao est em loop.
+        std::vector<Rect> sequence;     ///< Vetor de coodenadas de retângulos que representam os quadros.
+        bool              continuous{}; ///< Define se a animação é contínua.
+        bool              loop{};       ///< Define se a animação está em loop.
     };
 
-    using RectMap = std::unordered_map<unsigned, RectCoords>; ///< Mapa de animaes.
+    using RectMap = std::unordered_map<unsigned, RectCoords>; ///< Mapa de animações.
 
-    RectMap     rectMap;     ///< Mapa de animaes associadas a IDs.
-    RectCoords* selected{};  ///< Ponteiro para a animao atualmente selecionada.
-    int         index{};     ///< ndice do quadro atual.
-    unsigned    lastIndex{}; ///< ltimo ndice usado (para animaes contnuas).
-    unsigned    currentId{ std::numeric_limits<unsigned>::max() }; ///< ID da animao atual.
+    RectMap     rectMap;     ///< Mapa de animações associadas a IDs.
+    RectCoords* selected{};  ///< Ponteiro para a animação atualmente selecionada.
+    int         index{};     ///< Índice do quadro atual.
+    unsigned    lastIndex{}; ///< Último índice usado (para animações contínuas).
+    unsigned    currentId{ std::numeric_limits<unsigned>::max() }; ///< ID da animação atual.
 
-    Clock clock;         ///< Relgio para controle do tempo de execuo.
-    float elapsedTime{}; ///< Tempo decorrido desde o ltimo frame.
+    Clock clock;         ///< Relógio para controle do tempo de execução.
+    float elapsedTime{}; ///< Tempo decorrido desde o último frame.
 };
 
 // ---------------------------------------------------------------------------------------------------------------------
@@ -0,0 +1,148 @@
+#ifndef QUANTVERSO_ARENA_H
+#define QUANTVERSO_ARENA_H
+
+//--------------------------------------------------------------------------------------------------
+
+#include <array>
+#include <atomic>
+#include <mutex>
+#include <cstdint>
+
+//--------------------------------------------------------------------------------------------------
+
+////////////////////////////////////////////////////////////
+/// class Arena
+/// \brief Memória contígua em blocos para objetos triviais.
+///
+/// Os índices permanecem válidos enquanto a arena cresce, a
+/// alocação pode ser feita por várias threads e Clear()
+/// libera todos os objetos em O(1), mantendo os blocos.
+///
+////////////////////////////////////////////////////////////
+template <typename T>
+class Arena
+{
+public:
+	static constexpr uint32_t Full{ ~0u }; ///< Retorno de Allocate quando os blocos se esgotam
+
+	Arena() = default;
+	Arena(const Arena&) = delete;
+	Arena& operator=(const Arena&) = delete;
+	~Arena();
+
+	T& operator[](uint32_t index);
+	const T& operator[](uint32_t index) const;
+
+	////////////////////////////////////////////////////////////
+	/// \brief Reserva `count` objetos consecutivos.
+	///
+	/// O intervalo nunca atravessa a fronteira entre blocos.
+	///
+	/// \return Índice do primeiro objeto reservado ou Full se
+	///         não houver mais blocos; nada é reservado nesse
+	///         caso.
+	///
+	////////////////////////////////////////////////////////////
+	uint32_t Allocate(uint32_t count);
+
+	uint32_t Size() const;
+	bool Empty() const;
+	void Clear();
+
+private:
+	static constexpr uint32_t BlockBits{ 16 };
+	static constexpr uint32_t BlockSize{ 1u << BlockBits };
+	static constexpr uint32_t MaxBlocks{ 1u << 12 };
+
+	std::array<std::atomic<T*>, MaxBlocks> blocks{}; ///< Blocos alocados sob demanda
+	std::atomic<uint32_t>                  size{};   ///< Objetos em uso (inclui sobras de fim de bloco)
+	std::mutex                             mutex;    ///< Protege a criação de blocos
+};
+
+//--------------------------------------------------------------------------------------------------
+
+template <typename T>
+inline Arena<T>::~Arena()
+{
+	for (auto& block : blocks)
+		delete[] block.load();
+}
+
+//--------------------------------------------------------------------------------------------------
+
+template <typename T>
+inline T& Arena<T>::operator[](uint32_t index)
+{
+	return blocks[index >> BlockBits].load(std::memory_order_relaxed)[index & (BlockSize - 1)];
+}
+
+//--------------------------------------------------------------------------------------------------
+
+template <typename T>
+inline const T& Arena<T>::operator[](uint32_t index) const
+{
+	return blocks[index >> BlockBits].load(std::memory_order_relaxed)[index & (BlockSize - 1)];
+}
+
+//--------------------------------------------------------------------------------------------------
+
+template <typename T>
+inline uint32_t Arena<T>::Allocate(uint32_t count)
+{
+	uint32_t current{ size.load(std::memory_order_relaxed) };
+	uint32_t first;
+
+	do
+	{
+		// Se o intervalo não cabe no bloco atual, começa no próximo
+		first = current;
+		if ((first & (BlockSize - 1)) + count > BlockSize)
+			first = (first | (BlockSize - 1)) + 1;
+
+		// Sem blocos livres: o chamador decide como seguir sem a memória
+		if (first + count > MaxBlocks * BlockSize)
+			return Full;
+
+	} while (!size.compare_exchange_weak(current, first + count, std::memory_order_relaxed));
+
+	// Cria o bloco se ainda não existir
+	auto& block{ blocks[first >> BlockBits] };
+
+	if (!block.load(std::memory_order_acquire))
+	{
+		std::lock_guard lock{ mutex };
+
+		if (!block.load(std::memory_order_relaxed))
+			block.store(new T[BlockSize], std::memory_order_release);
+	}
+
+	return first;
+}
+
+//--------------------------------------------------------------------------------------------------
+
+template <typename T>
+inline uint32_t Arena<T>::Size() const
+{
+	return size.load(std::memory_order_relaxed);
+}
+
+//--------------------------------------------------------------------------------------------------
+
+template <typename T>
+inline bool Arena<T>::Empty() const
+{
+	return Size() == 0;
+}
+
+//--------------------------------------------------------------------------------------------------
+
+template <typename T>
+inline void Arena<T>::Clear()
+{
+	size.store(0, std::memory_order_relaxed);
+}
+
+//--------------------------------------------------------------------------------------------------
+
+#endif
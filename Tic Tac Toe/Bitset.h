@@ -0,0 +1,205 @@
+#ifndef QUANTVERSO_BITSET_H
+#define QUANTVERSO_BITSET_H
+
+//--------------------------------------------------------------------------------------------------
+
+#include <array>
+#include <bit>
+#include <cstdint>
+
+//--------------------------------------------------------------------------------------------------
+
+////////////////////////////////////////////////////////////
+/// class Bitset
+/// \brief Conjunto de casas em palavras de 64 bits.
+///
+/// O tamanho é fixo em tempo de compilação e os bits acima
+/// de `Bits` permanecem sempre zerados, de modo que Count()
+/// e a iteração não precisam de máscaras adicionais.
+///
+////////////////////////////////////////////////////////////
+template <int Bits>
+class Bitset
+{
+public:
+    static constexpr int Words{ (Bits + 63) / 64 };
+
+    constexpr void Set(int bit);
+    constexpr void Reset(int bit);
+    constexpr bool Test(int bit) const;
+    constexpr int Count() const;
+    constexpr bool Any() const;
+
+    // Palavra de 64 bits com as casas [64 * index, 64 * index + 63]
+    constexpr uint64_t Word(int index) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Índice do `n`-ésimo bit ligado (a partir de 0).
+    ///
+    /// Usado para sortear uma jogada sem montar uma lista.
+    ///
+    ////////////////////////////////////////////////////////////
+    constexpr int Select(int n) const;
+
+    template <typename Function>
+    constexpr void ForEach(Function function) const;
+
+    constexpr Bitset operator|(const Bitset& other) const;
+    constexpr Bitset operator&(const Bitset& other) const;
+    constexpr Bitset operator~() const;
+
+    constexpr bool operator==(const Bitset& other) const = default;
+
+    static constexpr Bitset Full();
+
+private:
+    // Bits válidos da última palavra
+    static constexpr uint64_t LastMask{ Bits % 64 ? (uint64_t(1) << (Bits % 64)) - 1 : ~uint64_t(0) };
+
+    std::array<uint64_t, Words> words{};
+};
+
+//--------------------------------------------------------------------------------------------------
+
+template <int Bits>
+inline constexpr void Bitset<Bits>::Set(int bit)
+{
+    words[bit >> 6] |= uint64_t(1) << (bit & 63);
+}
+
+//--------------------------------------------------------------------------------------------------
+
+template <int Bits>
+inline constexpr void Bitset<Bits>::Reset(int bit)
+{
+    words[bit >> 6] &= ~(uint64_t(1) << (bit & 63));
+}
+
+//--------------------------------------------------------------------------------------------------
+
+template <int Bits>
+inline constexpr bool Bitset<Bits>::Test(int bit) const
+{
+    return (words[bit >> 6] >> (bit & 63)) & 1;
+}
+
+//--------------------------------------------------------------------------------------------------
+
+template <int Bits>
+inline constexpr int Bitset<Bits>::Count() const
+{
+    int count{};
+    for (const uint64_t word : words)
+        count += std::popcount(word);
+
+    return count;
+}
+
+//--------------------------------------------------------------------------------------------------
+
+template <int Bits>
+inline constexpr bool Bitset<Bits>::Any() const
+{
+    for (const uint64_t word : words)
+    {
+        if (word)
+            return true;
+    }
+
+    return false;
+}
+
+//--------------------------------------------------------------------------------------------------
+
+template <int Bits>
+inline constexpr uint64_t Bitset<Bits>::Word(int index) const
+{
+    return words[index];
+}
+
+//--------------------------------------------------------------------------------------------------
+
+template <int Bits>
+inline constexpr int Bitset<Bits>::Select(int n) const
+{
+    for (int i{}; i < Words; ++i)
+    {
+        uint64_t word{ words[i] };
+
+        // Pula palavras inteiras pela contagem de bits
+        if (const int count{ std::popcount(word) }; n >= count)
+        {
+            n -= count;
+            continue;
+        }
+
+        for (; n > 0; --n)
+            word &= word - 1;
+
+        return i * 64 + std::countr_zero(word);
+    }
+
+    return -1;
+}
+
+//--------------------------------------------------------------------------------------------------
+
+template <int Bits>
+template <typename Function>
+inline constexpr void Bitset<Bits>::ForEach(Function function) const
+{
+    for (int i{}; i < Words; ++i)
+    {
+        for (uint64_t word{ words[i] }; word; word &= word - 1)
+            function(i * 64 + std::countr_zero(word));
+    }
+}
+
+//--------------------------------------------------------------------------------------------------
+
+template <int Bits>
+inline constexpr Bitset<Bits> Bitset<Bits>::operator|(const Bitset& other) const
+{
+    Bitset result;
+    for (int i{}; i < Words; ++i)
+        result.words[i] = words[i] | other.words[i];
+
+    return result;
+}
+
+//--------------------------------------------------------------------------------------------------
+
+template <int Bits>
+inline constexpr Bitset<Bits> Bitset<Bits>::operator&(const Bitset& other) const
+{
+    Bitset result;
+    for (int i{}; i < Words; ++i)
+        result.words[i] = words[i] & other.words[i];
+
+    return result;
+}
+
+//--------------------------------------------------------------------------------------------------
+
+template <int Bits>
+inline constexpr Bitset<Bits> Bitset<Bits>::operator~() const
+{
+    Bitset result;
+    for (int i{}; i < Words; ++i)
+        result.words[i] = ~words[i];
+
+    result.words[Words - 1] &= LastMask;
+    return result;
+}
+
+//--------------------------------------------------------------------------------------------------
+
+template <int Bits>
+inline constexpr Bitset<Bits> Bitset<Bits>::Full()
+{
+    return ~Bitset{};
+}
+
+//--------------------------------------------------------------------------------------------------
+
+#endif
@@ -2,59 +2,111 @@
 
 //--------------------------------------------------------------------------------------------------
 
-Player Board::CheckWinner() const
+uint64_t Board::CanonicalKey(const Hashes& hashes, int& symmetry)
 {
-    auto check{ [](int startRow, int startCol, int rowStep, int colStep, const std::array<std::array<Player, 3>, 3>& board) -> Player
-        {
-            const Player player{ board[startRow][startCol] };
+    // Posições equivalentes têm o mesmo conjunto de hashes: o menor deles é canônico
+    symmetry = 0;
+    for (int i{ 1 }; i < Symmetries; ++i)
+    {
+        if (hashes[i] < hashes[symmetry])
+            symmetry = i;
+    }
+
+    return hashes[symmetry];
+}
 
-            if (player == Player::None)
-                return Player::None;
+//--------------------------------------------------------------------------------------------------
 
-            for (int i{}; i < 2; ++i)
-            {
-                if (board[startRow += rowStep][startCol += colStep] != player)
-                    return Player::None;
-            }
+Board Board::Transformed(int symmetry) const
+{
+    // A imagem é uma posição nova, sem histórico
+    Board board;
+    board.masks = { Transform(masks[0], symmetry), Transform(masks[1], symmetry) };
+    board.Refresh();
 
-            return player;
-        }
-    };
+    return board;
+}
 
-    Player player;
+//--------------------------------------------------------------------------------------------------
 
-    // Verifica linhas e colunas
-    for (int i{}; i < 3; ++i)
+void Board::Refresh()
+{
+    // Recalcula do zero o estado que MakeMove/UnmakeMove mantêm incrementalmente
+    hash = 0;
+    counters = {};
+
+    for (int index{}; index < 2; ++index)
     {
-        if (player = check(i, 0, 0, 1, board); player != Player::None)
-            return player;
+        for (Mask mask{ masks[index] }; mask; mask &= mask - 1)
+        {
+            const int square{ std::countr_zero(mask) };
+            hash ^= zobrist[index * Size + square];
+            counters[index] += increments[square];
+        }
+    }
+}
+
+//--------------------------------------------------------------------------------------------------
+
+std::pair<Board, int> Board::Canonical() const
+{
+    // Forma canônica: a imagem com a menor codificação (X nos bits altos, O nos baixos)
+    auto code{ [](const Board& board) { return uint32_t(board.masks[1]) << Size | board.masks[0]; } };
+
+    std::pair<Board, int> canonical{ *this, 0 };
 
-        if (player = check(0, i, 1, 0, board); player != Player::None)
-            return player;
+    for (int symmetry{ 1 }; symmetry < Symmetries; ++symmetry)
+    {
+        if (Board image{ Transformed(symmetry) }; code(image) < code(canonical.first))
+            canonical = { image, symmetry };
     }
 
-    // Verifica diagonais
-    if (player = check(0, 0, 1, 1, board); player != Player::None)
-        return player;
+    return canonical;
+}
+
+//--------------------------------------------------------------------------------------------------
+
+Board::Hashes Board::SymmetricHashes() const
+{
+    Hashes hashes{};
 
-    if (player = check(0, 2, 1, -1, board); player != Player::None)
-        return player;
+    for (int index{}; index < 2; ++index)
+    {
+        for (Mask mask{ masks[index] }; mask; mask &= mask - 1)
+            Toggle(hashes, std::countr_zero(mask), index ? Player::X : Player::O);
+    }
 
-    return Player::None;
+    return hashes;
 }
 
 //--------------------------------------------------------------------------------------------------
 
-void Board::GetAvailableMoves(std::vector<Player*>& moves)
+Board::Mask Board::DistinctMoves() const
 {
-    for (auto& row : board)
+    // Simetrias que preservam a posição atual (estabilizador)
+    std::array<int, Symmetries> stabilizer;
+    int count{};
+
+    for (int symmetry{ 1 }; symmetry < Symmetries; ++symmetry)
     {
-        for (auto& move : row)
-        {
-            if (move == Player::None)
-                moves.push_back(&move);
-        }
+        if (Transform(masks[0], symmetry) == masks[0] && Transform(masks[1], symmetry) == masks[1])
+            stabilizer[count++] = symmetry;
     }
+
+    Mask available{ Available() };
+    Mask distinct{};
+
+    // Mantém uma jogada por classe de equivalência, descartando suas imagens
+    for (; available; available &= available - 1)
+    {
+        const int move{ std::countr_zero(available) };
+        distinct |= Mask(1 << move);
+
+        for (int i{}; i < count; ++i)
+            available &= ~Mask(1 << images[stabilizer[i]][move]) | Mask(1 << move);
+    }
+
+    return distinct;
 }
 
 //--------------------------------------------------------------------------------------------------
@@ -5,6 +5,10 @@
 
 #include <array>
 #include <vector>
+#include <cstdint>
+#include <bit>
+#include <utility>
+#include <cassert>
 
 //--------------------------------------------------------------------------------------------------
 
@@ -18,40 +22,558 @@ enum Player
 class Board
 {
 public:
+    using Mask   = uint16_t;
+    using Hashes = std::array<uint64_t, 8>;
+
+    static constexpr int  Size{ 9 };
+    static constexpr int  Symmetries{ 8 };
+    static constexpr int  Lines{ 8 };
+    static constexpr Mask Full{ 0x1FF };
+
+    ////////////////////////////////////////////////////////////
+    /// class MoveList
+    /// \brief Jogadas (casas 0 a 8) em capacidade fixa, sem
+    ///        alocação; pode ficar na pilha de cada chamada.
+    ///
+    ////////////////////////////////////////////////////////////
+    class MoveList
+    {
+    public:
+        void Clear();
+        void Push(int move);
+        int Count() const;
+        int operator[](int index) const;
+
+        const int8_t* begin() const;
+        const int8_t* end() const;
+
+    private:
+        std::array<int8_t, Size> moves;
+        int                      count{};
+    };
+
+    static constexpr Mask Line(int index);
+    static constexpr bool HasLine(Mask mask);
+    static constexpr int LinesThrough(int square);
+    static uint64_t Key(int square, Player player);
+    static uint64_t SideKey();
+
+    // Simetrias do tabuleiro (rotações e reflexões)
+    static constexpr Mask Transform(Mask mask, int symmetry);
+    static constexpr Mask Inverse(Mask mask, int symmetry);
+    static int TransformSquare(int square, int symmetry);
+    static int InverseSquare(int square, int symmetry);
+    static void Toggle(Hashes& hashes, int square, Player player);
+    static uint64_t CanonicalKey(const Hashes& hashes, int& symmetry);
+
     Player CheckWinner() const;
-    void GetAvailableMoves(std::vector<Player*>& moves);
+
+    // Nenhuma linha pode mais ser completada: o empate já está decidido
+    bool IsDeadDraw() const;
+
+    void GetAvailableMoves(MoveList& moves) const;
+
+    Mask Available() const;
+    Mask Occupied(Player player) const;
+    Player Turn() const;
+    Player Get(int square) const;
+    uint64_t Hash() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Edita uma casa livremente (montagem de posições).
+    ///
+    /// Recalcula o hash e os contadores das linhas e descarta o
+    /// histórico: UnmakeMove() não volta além deste ponto.
+    ///
+    ////////////////////////////////////////////////////////////
+    void Set(int square, Player player);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Joga na casa livre `square` pelo jogador da vez.
+    ///
+    /// O hash e os contadores das linhas que passam pela casa
+    /// são atualizados incrementalmente e a jogada é empilhada
+    /// para UnmakeMove(). Exige que a partida não tenha acabado.
+    ///
+    ////////////////////////////////////////////////////////////
+    void MakeMove(int square);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Desfaz a última jogada feita por MakeMove() desde
+    ///        o último Set().
+    ///
+    ////////////////////////////////////////////////////////////
+    void UnmakeMove();
+    int LastMove() const;
+
+    // Posições iguais independem do caminho (histórico) que levou a elas
+    bool operator==(const Board& other) const;
+
+    Board Transformed(int symmetry) const;
+    std::pair<Board, int> Canonical() const;
+    Hashes SymmetricHashes() const;
+    Mask DistinctMoves() const;
 
 private:
-    using BoardArray = std::array<std::array<Player, 3>, 3>;
+    // Linhas, colunas e diagonais (bit = linha * 3 + coluna)
+    static constexpr std::array<Mask, Lines> lines
+    {
+        0x007, 0x038, 0x1C0,
+        0x049, 0x092, 0x124,
+        0x111, 0x054
+    };
+
+    // Chaves de Zobrist: [jogador][casa] e, na última posição, a vez de X
+    static constexpr std::array<uint64_t, 2 * Size + 1> zobrist{ [] {
+        std::array<uint64_t, 2 * Size + 1> keys{};
+
+        // SplitMix64 com semente fixa
+        uint64_t state{ 0x9E3779B97F4A7C15 };
+        for (auto& key : keys)
+        {
+            uint64_t z{ state += 0x9E3779B97F4A7C15 };
+            z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9;
+            z = (z ^ (z >> 27)) * 0x94D049BB133111EB;
+            key = z ^ (z >> 31);
+        }
+
+        return keys;
+    }() };
+
+    // Imagem de cada casa sob cada simetria
+    static constexpr std::array<std::array<int8_t, Size>, Symmetries> images{ [] {
+        std::array<std::array<int8_t, Size>, Symmetries> squares{};
+
+        // Mesma ordem de Transform: espelha colunas, espelha linhas e transpõe
+        for (int symmetry{}; symmetry < Symmetries; ++symmetry)
+        {
+            for (int square{}; square < Size; ++square)
+            {
+                int row{ square / 3 }, col{ square % 3 };
+
+                if (symmetry & 1)
+                    col = 2 - col;
+
+                if (symmetry & 2)
+                    row = 2 - row;
+
+                if (symmetry & 4)
+                    std::swap(row, col);
+
+                squares[symmetry][square] = int8_t(row * 3 + col);
+            }
+        }
+
+        return squares;
+    }() };
+
+    // Contadores de pedras por linha: 2 bits por linha, a linha i nos bits 2i e 2i + 1
+    using Counters = uint16_t;
+
+    static constexpr Counters LowBits{ 0x5555 };  // Bit baixo de cada contador
+
+    // Soma a aplicar aos contadores de quem joga em cada casa: +1 em cada linha que passa por ela
+    static constexpr std::array<Counters, Size> increments{ [] {
+        std::array<Counters, Size> table{};
+
+        for (int square{}; square < Size; ++square)
+        {
+            for (int line{}; line < Lines; ++line)
+            {
+                if (lines[line] >> square & 1)
+                    table[square] += Counters(1 << 2 * line);
+            }
+        }
+
+        return table;
+    }() };
+
+    static constexpr Counters Complete(Counters counters);
+    static constexpr Counters Touched(Counters counters);
+
+    void Refresh();
+
+    static constexpr Mask FlipColumns(Mask mask);
+    static constexpr Mask FlipRows(Mask mask);
+    static constexpr Mask Transpose(Mask mask);
+
+    class Cell
+    {
+    public:
+        Cell(Board& board, int square) :
+            board{ board },
+            square{ square }
+        {
+        }
+
+        operator Player() const
+        {
+            return board.Get(square);
+        }
+
+        Cell& operator=(Player player)
+        {
+            board.Set(square, player);
+            return *this;
+        }
+
+    private:
+        Board& board;
+        int    square;
+    };
 
     class Reference
     {
     public:
-        Reference(BoardArray& board, size_t index) :
+        Reference(Board& board, size_t index) :
             board{ board },
             firstIndex{ index }
         {
         }
 
-        Player& operator[](size_t secondIndex) const
+        Cell operator[](size_t secondIndex) const
         {
-            return board[firstIndex][secondIndex];
+            return Cell(board, int(firstIndex * 3 + secondIndex));
         }
 
     private:
-        BoardArray& board;
-        size_t      firstIndex;
+        Board& board;
+        size_t firstIndex;
     };
 
-    BoardArray board;
+    // Ocupação de cada jogador: [0] = O, [1] = X
+    std::array<Mask, 2> masks{};
+
+    // Estado mantido incrementalmente por Set/MakeMove/UnmakeMove
+    std::array<Counters, 2> counters{};       // Pedras de cada jogador por linha, como em masks
+    uint64_t                history{ ~0ull }; // Pilha de casas jogadas, 4 bits cada (0xF = vazia)
+    uint64_t                hash{};           // Zobrist das pedras (sem a chave da vez)
+
+    static int Index(Player player);
 
 public:
     const Reference operator[](size_t index)
     {
-        return Reference(board, index);
+        return Reference(*this, index);
     }
 };
 
 //--------------------------------------------------------------------------------------------------
 
+inline constexpr Board::Mask Board::Line(int index)
+{
+    return lines[index];
+}
+
+//--------------------------------------------------------------------------------------------------
+
+inline constexpr bool Board::HasLine(Mask mask)
+{
+    for (const Mask line : lines)
+    {
+        if ((mask & line) == line)
+            return true;
+    }
+
+    return false;
+}
+
+//--------------------------------------------------------------------------------------------------
+
+inline constexpr int Board::LinesThrough(int square)
+{
+    int count{};
+    for (const Mask line : lines)
+        count += (line >> square) & 1;
+
+    return count;
+}
+
+//--------------------------------------------------------------------------------------------------
+
+inline uint64_t Board::Key(int square, Player player)
+{
+    return zobrist[Index(player) * Size + square];
+}
+
+//--------------------------------------------------------------------------------------------------
+
+inline uint64_t Board::SideKey()
+{
+    return zobrist[2 * Size];
+}
+
+//--------------------------------------------------------------------------------------------------
+
+inline constexpr Board::Mask Board::FlipColumns(Mask mask)
+{
+    return Mask(((mask & 0x049) << 2) | ((mask & 0x124) >> 2) | (mask & 0x092));
+}
+
+//--------------------------------------------------------------------------------------------------
+
+inline constexpr Board::Mask Board::FlipRows(Mask mask)
+{
+    return Mask(((mask & 0x007) << 6) | ((mask & 0x1C0) >> 6) | (mask & 0x038));
+}
+
+//--------------------------------------------------------------------------------------------------
+
+inline constexpr Board::Mask Board::Transpose(Mask mask)
+{
+    // Troca as casas (l, c) e (c, l) com duas trocas delta: 1 <-> 3, 5 <-> 7 e 2 <-> 6
+    Mask swap{ Mask(((mask >> 2) ^ mask) & 0x022) };
+    mask ^= swap ^ (swap << 2);
+
+    swap = Mask(((mask >> 4) ^ mask) & 0x004);
+    return mask ^ swap ^ (swap << 4);
+}
+
+//--------------------------------------------------------------------------------------------------
+
+inline constexpr Board::Mask Board::Transform(Mask mask, int symmetry)
+{
+    // Cada simetria é uma combinação de espelhar colunas, espelhar linhas e transpor
+    if (symmetry & 1)
+        mask = FlipColumns(mask);
+
+    if (symmetry & 2)
+        mask = FlipRows(mask);
+
+    if (symmetry & 4)
+        mask = Transpose(mask);
+
+    return mask;
+}
+
+//--------------------------------------------------------------------------------------------------
+
+inline constexpr Board::Mask Board::Inverse(Mask mask, int symmetry)
+{
+    // As operações são involuções: basta aplicá-las na ordem inversa
+    if (symmetry & 4)
+        mask = Transpose(mask);
+
+    if (symmetry & 2)
+        mask = FlipRows(mask);
+
+    if (symmetry & 1)
+        mask = FlipColumns(mask);
+
+    return mask;
+}
+
+//--------------------------------------------------------------------------------------------------
+
+inline int Board::TransformSquare(int square, int symmetry)
+{
+    return images[symmetry][square];
+}
+
+//--------------------------------------------------------------------------------------------------
+
+inline int Board::InverseSquare(int square, int symmetry)
+{
+    return std::countr_zero(Inverse(Mask(1 << square), symmetry));
+}
+
+//--------------------------------------------------------------------------------------------------
+
+inline void Board::Toggle(Hashes& hashes, int square, Player player)
+{
+    for (int symmetry{}; symmetry < Symmetries; ++symmetry)
+        hashes[symmetry] ^= Key(images[symmetry][square], player);
+}
+
+//--------------------------------------------------------------------------------------------------
+
+inline int Board::Index(Player player)
+{
+    return player == Player::X;
+}
+
+//--------------------------------------------------------------------------------------------------
+
+inline void Board::MoveList::Clear()
+{
+    count = 0;
+}
+
+//--------------------------------------------------------------------------------------------------
+
+inline void Board::MoveList::Push(int move)
+{
+    moves[count++] = int8_t(move);
+}
+
+//--------------------------------------------------------------------------------------------------
+
+inline int Board::MoveList::Count() const
+{
+    return count;
+}
+
+//--------------------------------------------------------------------------------------------------
+
+inline int Board::MoveList::operator[](int index) const
+{
+    return moves[index];
+}
+
+//--------------------------------------------------------------------------------------------------
+
+inline const int8_t* Board::MoveList::begin() const
+{
+    return moves.data();
+}
+
+//--------------------------------------------------------------------------------------------------
+
+inline const int8_t* Board::MoveList::end() const
+{
+    return moves.data() + count;
+}
+
+//--------------------------------------------------------------------------------------------------
+
+inline constexpr Board::Counters Board::Complete(Counters counters)
+{
+    // Contador 3 (binário 11) em alguma linha
+    return counters & counters >> 1 & LowBits;
+}
+
+//--------------------------------------------------------------------------------------------------
+
+inline constexpr Board::Counters Board::Touched(Counters counters)
+{
+    // Contador diferente de zero em cada linha
+    return (counters | counters >> 1) & LowBits;
+}
+
+//--------------------------------------------------------------------------------------------------
+
+inline Player Board::CheckWinner() const
+{
+    return Complete(counters[0]) ? Player::O : Complete(counters[1]) ? Player::X : Player::None;
+}
+
+//--------------------------------------------------------------------------------------------------
+
+inline bool Board::IsDeadDraw() const
+{
+    // Toda linha tem pedras dos dois jogadores
+    return (Touched(counters[0]) & Touched(counters[1])) == LowBits;
+}
+
+//--------------------------------------------------------------------------------------------------
+
+inline void Board::GetAvailableMoves(MoveList& moves) const
+{
+    moves.Clear();
+
+    // Extrai as casas livres do bit menos significativo para o mais significativo
+    for (Mask available{ Available() }; available; available &= available - 1)
+        moves.Push(std::countr_zero(available));
+}
+
+//--------------------------------------------------------------------------------------------------
+
+inline Board::Mask Board::Available() const
+{
+    return ~(masks[0] | masks[1]) & Full;
+}
+
+//--------------------------------------------------------------------------------------------------
+
+inline Board::Mask Board::Occupied(Player player) const
+{
+    return masks[Index(player)];
+}
+
+//--------------------------------------------------------------------------------------------------
+
+inline Player Board::Turn() const
+{
+    // X começa: é a vez de O quando X tem uma pedra a mais
+    return std::popcount(masks[1]) > std::popcount(masks[0]) ? Player::O : Player::X;
+}
+
+//--------------------------------------------------------------------------------------------------
+
+inline Player Board::Get(int square) const
+{
+    const Mask bit{ Mask(1 << square) };
+    return masks[0] & bit ? Player::O : masks[1] & bit ? Player::X : Player::None;
+}
+
+//--------------------------------------------------------------------------------------------------
+
+inline uint64_t Board::Hash() const
+{
+    return hash;
+}
+
+//--------------------------------------------------------------------------------------------------
+
+inline void Board::Set(int square, Player player)
+{
+    const Mask bit{ Mask(1 << square) };
+
+    masks[0] &= ~bit;
+    masks[1] &= ~bit;
+
+    if (player != Player::None)
+        masks[Index(player)] |= bit;
+
+    Refresh();
+    history = ~0ull;
+}
+
+//--------------------------------------------------------------------------------------------------
+
+inline void Board::MakeMove(int square)
+{
+    const Player player{ Turn() };
+    const int index{ Index(player) };
+
+    masks[index] |= Mask(1 << square);
+    counters[index] += increments[square];
+    hash ^= Key(square, player);
+    history = history << 4 | uint64_t(square);
+}
+
+//--------------------------------------------------------------------------------------------------
+
+inline void Board::UnmakeMove()
+{
+    // Histórico vazio: o nibble 0xF indexaria fora da tabela de incrementos
+    assert((history & 0xF) != 0xF);
+
+    const int square{ int(history & 0xF) };
+    const Mask bit{ Mask(1 << square) };
+    const int index{ masks[1] & bit ? 1 : 0 };
+
+    masks[index] &= ~bit;
+    counters[index] -= increments[square];
+    hash ^= zobrist[index * Size + square];
+    history >>= 4;
+}
+
+//--------------------------------------------------------------------------------------------------
+
+inline int Board::LastMove() const
+{
+    const int square{ int(history & 0xF) };
+    return square < Size ? square : -1;
+}
+
+//--------------------------------------------------------------------------------------------------
+
+inline bool Board::operator==(const Board& other) const
+{
+    return masks == other.masks;
+}
+
+//--------------------------------------------------------------------------------------------------
+
 #endif
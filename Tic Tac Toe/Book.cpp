@@ -0,0 +1,97 @@
+#include "Book.h"
+#include <algorithm>
+#include <fstream>
+
+//--------------------------------------------------------------------------------------------------
+
+static_assert(sizeof(Book::Entry) == 16, "Entradas do livro devem ter 16 bytes");
+
+//--------------------------------------------------------------------------------------------------
+
+bool Book::Open(const char* path)
+{
+    Close();
+
+    if (!file.Open(path))
+        return false;
+
+    // O cabeçalho deve bater e o tamanho deve corresponder exatamente às entradas declaradas
+    const Header& header{ *reinterpret_cast<const Header*>(file.Data()) };
+    const size_t length{ file.Size() };
+
+    if (length < sizeof(Header) || header.magic != Magic || header.version != Version ||
+        (length - sizeof(Header)) / sizeof(Entry) != header.count || (length - sizeof(Header)) % sizeof(Entry))
+    {
+        Close();
+        return false;
+    }
+
+    entries = reinterpret_cast<const Entry*>(file.Data() + sizeof(Header));
+    count = size_t(header.count);
+
+    return true;
+}
+
+//--------------------------------------------------------------------------------------------------
+
+void Book::Close()
+{
+    file.Close();
+    entries = nullptr;
+    count = 0;
+}
+
+//--------------------------------------------------------------------------------------------------
+
+bool Book::Probe(const Board& board, int& move, int& value) const
+{
+    int symmetry;
+    const uint64_t key{ Board::CanonicalKey(board.SymmetricHashes(), symmetry) };
+
+    const Entry* entry{ std::lower_bound(entries, entries + count, key,
+        [](const Entry& entry, uint64_t key) { return entry.key < key; }) };
+
+    if (entry == entries + count || entry->key != key)
+        return false;
+
+    // A jogada volta da orientação canônica para a do tabuleiro consultado
+    move = Board::InverseSquare(entry->move, symmetry);
+    value = entry->value;
+
+    return true;
+}
+
+//--------------------------------------------------------------------------------------------------
+
+Book::Entry Book::MakeEntry(const Board& board, int move, int value)
+{
+    int symmetry;
+    Entry entry{};
+
+    entry.key = Board::CanonicalKey(board.SymmetricHashes(), symmetry);
+    entry.move = int8_t(Board::TransformSquare(move, symmetry));
+    entry.value = int8_t(value);
+
+    return entry;
+}
+
+//--------------------------------------------------------------------------------------------------
+
+bool Book::Write(const char* path, std::vector<Entry>& entries)
+{
+    std::sort(entries.begin(), entries.end(), [](const Entry& a, const Entry& b) { return a.key < b.key; });
+
+    // Posições simétricas têm a mesma chave: basta uma entrada de cada
+    entries.erase(std::unique(entries.begin(), entries.end(),
+        [](const Entry& a, const Entry& b) { return a.key == b.key; }), entries.end());
+
+    std::ofstream file{ path, std::ios::binary | std::ios::trunc };
+
+    const Header header{ Magic, Version, entries.size() };
+    file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    file.write(reinterpret_cast<const char*>(entries.data()), std::streamsize(entries.size() * sizeof(Entry)));
+
+    return bool(file);
+}
+
+//--------------------------------------------------------------------------------------------------
@@ -0,0 +1,90 @@
+#ifndef QUANTVERSO_BOOK_H
+#define QUANTVERSO_BOOK_H
+
+//--------------------------------------------------------------------------------------------------
+
+#include "Board.h"
+#include "MappedFile.h"
+
+//--------------------------------------------------------------------------------------------------
+
+////////////////////////////////////////////////////////////
+/// class Book
+/// \brief Livro de aberturas mapeado em memória.
+///
+/// O arquivo é um cabeçalho seguido de entradas de 16 bytes
+/// ordenadas pela chave canônica da posição (o menor dos oito
+/// hashes simétricos). A jogada é guardada na orientação
+/// canônica e convertida de volta na consulta, que é uma busca
+/// binária direto sobre as páginas mapeadas: sem alocação e
+/// sem leitura do arquivo inteiro na abertura.
+///
+/// O formato usa a ordem de bytes da máquina que o gerou.
+///
+////////////////////////////////////////////////////////////
+class Book
+{
+public:
+    struct Entry
+    {
+        uint64_t key;        // Chave canônica da posição
+        int8_t   move;       // Melhor jogada na orientação canônica
+        int8_t   value;      // Utilidade para o jogador da vez (mesma escala de GameTable)
+        int8_t   unused[6];
+    };
+
+    static constexpr uint32_t Magic{ 0x4B425651 };  // "QVBK"
+    static constexpr uint32_t Version{ 1 };
+
+    // Mapeia o arquivo somente para leitura; falha se ele não existir ou for inválido
+    bool Open(const char* path);
+    void Close();
+
+    bool IsOpen() const;
+    size_t Size() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Procura a posição no livro.
+    ///
+    /// \return Verdadeiro se encontrada, com a jogada já na
+    ///         orientação de `board` e o seu valor.
+    ///
+    ////////////////////////////////////////////////////////////
+    bool Probe(const Board& board, int& move, int& value) const;
+
+    // Entrada da posição com `move` e `value` dados na orientação de `board`
+    static Entry MakeEntry(const Board& board, int move, int value);
+
+    // Ordena as entradas e grava o livro em `path`
+    static bool Write(const char* path, std::vector<Entry>& entries);
+
+private:
+    struct Header
+    {
+        uint32_t magic;
+        uint32_t version;
+        uint64_t count;
+    };
+
+    MappedFile   file;
+    const Entry* entries{};
+    size_t       count{};
+};
+
+//--------------------------------------------------------------------------------------------------
+
+inline bool Book::IsOpen() const
+{
+    return file.IsOpen();
+}
+
+//--------------------------------------------------------------------------------------------------
+
+inline size_t Book::Size() const
+{
+    return count;
+}
+
+//--------------------------------------------------------------------------------------------------
+
+#endif
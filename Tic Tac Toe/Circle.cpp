@@ -12,7 +12,7 @@ Circle::Circle() :
 
 void Circle::Draw(Window* window) const
 {
-	constexpr size_t precision{ 25 };	    // Menor preciso por quadrante
+	constexpr size_t precision{ 25 };	    // Menor precisão por quadrante
 	constexpr size_t size{ precision * 4 }; // Tamanho do vetor de pontos
 	constexpr size_t halfSize{ size / 2 };  // Metade do tamanho do vetor
 	constexpr float  step{ float(M_PI / (2 * precision)) }; // Passo para iterar pelo primeiro quadrante
@@ -43,12 +43,12 @@ void Circle::Draw(Window* window) const
 
 bool Circle::CheckCollision(const Circle* other) const
 {
-	// Calcula a distncia entre os centros dos dois crculos
+	// Calcula a distância entre os centros dos dois círculos
 	float dx{ this->position.x - other->position.x };
 	float dy{ this->position.y - other->position.y };
 	float distanceSquared{ dx * dx + dy * dy };
 
-	// Verifica se a soma dos raios  maior ou igual  distncia entre os centros
+	// Verifica se a soma dos raios é maior ou igual à distância entre os centros
 	float radiusSum{ this->Radius() + other->Radius() };
 
 	return distanceSquared <= (radiusSum * radiusSum);
@@ -13,13 +13,13 @@ Collider::Collider(Entity* entity, Type type) :
     standard{},
     OnCollision{}
 {
-    // Atribui o prprio endereo ao ponteiro no componente transform
+    // Atribui o próprio endereço ao ponteiro no componente transform
     BindDependencies(this);    
 
-    // Coloca o endereo deste colisor na lista de colisores
+    // Coloca o endereço deste colisor na lista de colisores
     colliders->push_back(this);
 
-    //Cria um delimitador de coliso padro
+    //Cria um delimitador de colisão padrão
     Add(std::make_unique<Rectangle>());
     standard = true;
     
@@ -57,7 +57,7 @@ void Collider::Position(float x, float y)
 
 Shape* Collider::Add(std::unique_ptr<Shape> shape)
 {
-    // Remove delimitador de coliso padro
+    // Remove delimitador de colisão padrão
     if (standard)
     {
         boundings.clear();
@@ -69,10 +69,10 @@ Shape* Collider::Add(std::unique_ptr<Shape> shape)
 
     auto b{ boundings.back().get()};
 
-    // Cor do desenho geomtrico do delimitador
+    // Cor do desenho geométrico do delimitador
     b->Color(Color::Magenta);
 
-    // Define a posio do delimitador de coliso
+    // Define a posição do delimitador de colisão
     b->Position(float(entity->transform.bounds.Left()), float(entity->transform.bounds.Top()));
 
     // Ajustes de formas simples
@@ -100,11 +100,11 @@ void Collider::Update()
         for (const auto& other : *colliders) // Percorre os colisores existentes
         {
             if (other != this && // Se o colisor for diferente deste
-                collided.find(other) == collided.end()) // e no colidiu com este
+                collided.find(other) == collided.end()) // e não colidiu com este
             {
                 if (this->IsColliding(other))
                 {
-                    // Chama os mtodos de coliso dos objetos envolvidos
+                    // Chama os métodos de colisão dos objetos envolvidos
                     (this->entity->*OnCollision)(*other->entity);
                     (other->entity->*OnCollision)(*this->entity);
 
@@ -15,11 +15,11 @@ class Shape;
 
 ////////////////////////////////////////////////////////////
 /// \class Collider
-/// \brief Responsvel por gerenciar colisores e detectar colises entre objetos.
+/// \brief Responsável por gerenciar colisores e detectar colisões entre objetos.
 ///
-/// A classe Collider mantm e gerencia os objetos com delimitadores de coliso, permitindo
-/// a verificao de colises entre diferentes tipos de objetos (estticos ou mveis) e a
-/// interao entre suas formas geomtricas.
+/// A classe Collider mantém e gerencia os objetos com delimitadores de colisão, permitindo
+/// a verificação de colisões entre diferentes tipos de objetos (estáticos ou móveis) e a
+/// interação entre suas formas geométricas.
 /// 
 ////////////////////////////////////////////////////////////
 class Collider : public Component
@@ -30,26 +30,26 @@ public:
     /// \brief Define o tipo de colisor: Ativo ou Passivo.
     ///
     /// O enum Type classifica os tipos de colisores em ativos ou passivos.
-    /// - Um **colisor ativo** deve ser utilizado em objetos dinmicos que
-    ///   causam colises com outros objetos.
-    /// - Um **colisor passivo**  apropriado para objetos estticos que
-    ///   no iniciam colises, mas podem ser atingidos por colisores ativos.
+    /// - Um **colisor ativo** deve ser utilizado em objetos dinâmicos que
+    ///   causam colisões com outros objetos.
+    /// - Um **colisor passivo** é apropriado para objetos estáticos que
+    ///   não iniciam colisões, mas podem ser atingidos por colisores ativos.
     ///
-    /// Esses tipos ajudam a otimizar o comportamento da simulao de coliso,
+    /// Esses tipos ajudam a otimizar o comportamento da simulação de colisão,
     /// diferenciando entre objetos que interagem ativamente e os que permanecem
-    /// inertes no cenrio.
+    /// inertes no cenário.
     ///
     ////////////////////////////////////////////////////////////
     enum Type
     {
-        Active,  ///< Colisor ativo: usado em objetos mveis que causam coliso.
-        Passive  ///< Colisor passivo: usado em objetos estticos que no causam coliso.
+        Active,  ///< Colisor ativo: usado em objetos móveis que causam colisão.
+        Passive  ///< Colisor passivo: usado em objetos estáticos que não causam colisão.
     };
 
     ////////////////////////////////////////////////////////////
     /// \brief Construtor da classe `Collider`.
     ///
-    /// Inicializa o colisor com a entidade associada e define o tipo (esttico ou mvel).
+    /// Inicializa o colisor com a entidade associada e define o tipo (estático ou móvel).
     ///
     /// \param entity Ponteiro para a entidade associada.
     /// \param type Tipo do colisor (Static ou Moving).
@@ -66,11 +66,11 @@ public:
     ~Collider();
     
     ////////////////////////////////////////////////////////////
-    /// \brief Adiciona um delimitador de coliso.
+    /// \brief Adiciona um delimitador de colisão.
     ///
-    /// \tparam T A forma geomtrica a ser adicionada ao colisor.
+    /// \tparam T A forma geométrica a ser adicionada ao colisor.
     /// 
-    /// \return Um ponteiro para a forma recm-adicionada.
+    /// \return Um ponteiro para a forma recém-adicionada.
     /// 
     ////////////////////////////////////////////////////////////
     template <typename T, typename... Args>
@@ -84,17 +84,17 @@ private:
 
     Type                                type;      ///< Tipo de colisor (Active, Passive)
     std::unordered_set<Collider*>       collided;  ///< Armazena colisores que colidiram com este
-    std::vector<std::unique_ptr<Shape>> boundings; ///< Vetor de delimitadores de coliso
+    std::vector<std::unique_ptr<Shape>> boundings; ///< Vetor de delimitadores de colisão
     std::list<Collider*>*               colliders; ///< Lista com todos colisores instanciados
-    bool                                standard;  ///< Indica se o delimitador de coliso  padro    
+    bool                                standard;  ///< Indica se o delimitador de colisão é padrão    
 
     ////////////////////////////////////////////////////////////
-    /// \brief Lida com colises a entidade deste colisor e outra.
+    /// \brief Lida com colisões a entidade deste colisor e outra.
     ///
-    /// Este mtodo virtual  chamado quando h uma coliso entre
+    /// Este método virtual é chamado quando há uma colisão entre
     /// a entidade deste colisor e outra entidade do jogo.
     /// 
-    /// \param obj Uma referncia para a entidade colidida.
+    /// \param obj Uma referência para a entidade colidida.
     ///
     ////////////////////////////////////////////////////////////
     void (Entity::* OnCollision)(Entity&);
@@ -102,13 +102,13 @@ private:
     ////////////////////////////////////////////////////////////
     /// \brief Atualiza o estado do colisor.
     ///
-    /// Executa operaes necessrias para atualizar a lgica de coliso e interaes.
+    /// Executa operações necessárias para atualizar a lógica de colisão e interações.
     ///
     ////////////////////////////////////////////////////////////
     void Update();
 
     ////////////////////////////////////////////////////////////
-    /// \brief Desenha os delimitadores de coliso.
+    /// \brief Desenha os delimitadores de colisão.
     ///
     /// Se `visible` for true, desenha visualmente os colisores.
     /// 
@@ -116,21 +116,21 @@ private:
     void Draw();
 
     ////////////////////////////////////////////////////////////
-    /// \brief Posiciona os delimitadores de coliso.
+    /// \brief Posiciona os delimitadores de colisão.
     ///
-    /// Este metodo posiciona todos os delimitadores de coliso
+    /// Este metodo posiciona todos os delimitadores de colisão
     /// com base nos valores informados em x e y.
     /// 
-    /// \param x Posio no eixo x para os delimitadores.
-    /// \param y Posio no eixo y para os delimitadores.
+    /// \param x Posição no eixo x para os delimitadores.
+    /// \param y Posição no eixo y para os delimitadores.
     /// 
     ////////////////////////////////////////////////////////////
     void Position(float x, float y);
 
     ////////////////////////////////////////////////////////////
-    /// \brief Adiciona um delimitador de coliso.
+    /// \brief Adiciona um delimitador de colisão.
     ///
-    /// \param geometry Forma geomtrica do delimitador (Rectangle, Circle, etc.).
+    /// \param geometry Forma geométrica do delimitador (Rectangle, Circle, etc.).
     /// \param offsetX Deslocamento horizontal opcional.
     /// \param offsetY Deslocamento vertical opcional.
     /// 
@@ -138,19 +138,19 @@ private:
     Shape* Add(std::unique_ptr<Shape> shape);
 
     ////////////////////////////////////////////////////////////
-    /// \brief Verifica se h coliso entre dois conjuntos de delimitadores.
+    /// \brief Verifica se há colisão entre dois conjuntos de delimitadores.
     ///
-    /// Este mtodo percorre dois conjuntos de delimitadores (`Bounding`),
+    /// Este método percorre dois conjuntos de delimitadores (`Bounding`),
     /// comparando cada delimitador de um conjunto com cada delimitador do outro.
-    /// Para cada par de delimitadores, chama internamente o mtodo `CheckCollision()`,
-    /// que realiza a verificao real da coliso entre dois delimitadores.
+    /// Para cada par de delimitadores, chama internamente o método `CheckCollision()`,
+    /// que realiza a verificação real da colisão entre dois delimitadores.
     ///
-    /// \param boundings Um par de vetores contendo os delimitadores de coliso:
+    /// \param boundings Um par de vetores contendo os delimitadores de colisão:
     /// - O primeiro vetor representa os delimitadores do primeiro objeto.
     /// - O segundo vetor representa os delimitadores do segundo objeto.
     ///
     /// \return Retorna `true` se qualquer par de delimitadores de objetos distintos
-    /// estiver colidindo, caso contrrio, retorna `false`.
+    /// estiver colidindo, caso contrário, retorna `false`.
     /// 
     ////////////////////////////////////////////////////////////
     bool IsColliding(const Collider* other);
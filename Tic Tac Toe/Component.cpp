@@ -5,7 +5,7 @@
 
 // ------------------------------------------------------------------------------------------------
 
-Window& Component::window{ Engine::window }; ///< Referncia para a janela grfica
+Window& Component::window{ Engine::window }; ///< Referência para a janela gráfica
 
 //--------------------------------------------------------------------------------------------------
 
@@ -22,26 +22,26 @@ public:
 	virtual ~Component() = default;
 
 protected:
-	static Window& window; ///< Referncia para a janela grfica
+	static Window& window; ///< Referência para a janela gráfica
 
 	Entity* const entity; ///< Entidade a qual pertence o componente
-	Scene* const& scene;  ///< Referncia para a cena
+	Scene* const& scene;  ///< Referência para a cena
 
 	////////////////////////////////////////////////////////////
-	/// \brief Vincula dependncias entre componentes derivados.
+	/// \brief Vincula dependências entre componentes derivados.
 	///
-	/// Este mtodo estabelece as dependncias necessrias entre
+	/// Este método estabelece as dependências necessárias entre
 	/// componentes de uma entidade, permitindo que um componente A 
-	/// tenha acesso a mtodos e atributos privados de outro componente B.
+	/// tenha acesso a métodos e atributos privados de outro componente B.
 	/// Deve ser chamado explicitamente no construtor da classe derivada 
-	/// que necessita dessas dependncias.
+	/// que necessita dessas dependências.
 	///
-	/// O mtodo utiliza a funo \c typeid para verificar o tipo do componente
-	/// e realizar o casting adequado para ajustar as referncias e ponteiros
-	/// s dependncias necessrias.
+	/// O método utiliza a função \c typeid para verificar o tipo do componente
+	/// e realizar o casting adequado para ajustar as referências e ponteiros
+	/// às dependências necessárias.
 	///
 	/// \param component Ponteiro para o componente derivado que precisa
-	///        ter suas dependncias configuradas.
+	///        ter suas dependências configuradas.
 	///
 	////////////////////////////////////////////////////////////
 	void BindDependencies(Transform* transform);
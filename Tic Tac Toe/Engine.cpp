@@ -30,11 +30,11 @@ void Engine::Loop()
 
     while (true)
     {
-        // Tempo decorrido desde o ltimo frame
+        // Tempo decorrido desde o último frame
         deltaTime = clock.ElapsedTime();
 
 #ifdef _DEBUG
-        // Atualiza o ttulo da janela
+        // Atualiza o título da janela
         cycles++;
         if (clock.Count() >= 1.f)
         {
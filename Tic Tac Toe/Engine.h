@@ -11,29 +11,29 @@ class Scene;
 
 ////////////////////////////////////////////////////////////
 /// class Engine
-/// \brief Classe responsvel pelo loop do jogo, gerenciamento
-/// de eventos e comunicao entre as demais classes.
+/// \brief Classe responsável pelo loop do jogo, gerenciamento
+/// de eventos e comunicação entre as demais classes.
 /// 
 ////////////////////////////////////////////////////////////
 class Engine
 {
 public:
-    inline static Window window;    ///< Janela grfica 
+    inline static Window window;    ///< Janela gráfica 
     inline static float  deltaTime; ///< Tempo decorrido entre frames
 
     ////////////////////////////////////////////////////////////
     /// \brief Carrega uma cena na Engine.
     /// 
-    /// Este mtodo inicializa a Engine com a cena fornecida quando chamado pela primeira vez.
-    /// Caso j exista uma cena anterior, ela ser destruda e substituda pela nova cena.
+    /// Este método inicializa a Engine com a cena fornecida quando chamado pela primeira vez.
+    /// Caso já exista uma cena anterior, ela será destruída e substituída pela nova cena.
     /// 
     /// \param scene Ponteiro para o objeto da cena do jogo a ser carregada.
     /// 
-    /// \note Este mtodo invoca `Loop()` para iniciar o loop principal de execuo do jogo,
+    /// \note Este método invoca `Loop()` para iniciar o loop principal de execução do jogo,
     /// quando chamado pela primeira vez.
     /// 
-    /// \warning Aps o mtodo ser executado, se uma cena anterior existia,
-    /// ela ser deletada da memria e substituda pela cena atual.
+    /// \warning Após o método ser executado, se uma cena anterior existia,
+    /// ela será deletada da memória e substituída pela cena atual.
     /// 
     ////////////////////////////////////////////////////////////
     static void Run(Scene* scene);
@@ -42,9 +42,9 @@ private:
     inline static Scene* scene; ///< Cena atual
 
     ////////////////////////////////////////////////////////////
-    /// \brief Lao principal do jogo.
+    /// \brief Laço principal do jogo.
     /// 
-    /// O lao roda enquanto a janela grfica estiver aberta.
+    /// O laço roda enquanto a janela gráfica estiver aberta.
     /// 
     ////////////////////////////////////////////////////////////
     static void Loop();
@@ -4,7 +4,7 @@
 
 // ------------------------------------------------------------------------------------------------
 
-Window& Entity::window{ Engine::window };		///< Janela grfica
+Window& Entity::window{ Engine::window };		///< Janela gráfica
 float&  Entity::deltaTime{ Engine::deltaTime };	///< Tempo decorrido entre frames
 
 //--------------------------------------------------------------------------------------------------
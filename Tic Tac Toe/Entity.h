@@ -30,13 +30,13 @@ class Scene;
 class Entity
 {
 public:
-    const std::string& id;      ///< Identificao nica do objeto
+    const std::string& id;      ///< Identificação única do objeto
     const std::string& tag;     ///< Tag para agrupar o objeto
     Scene* const&      scene;   ///< Referencia para a cena
     bool               visible; ///< Controla a visibilidade do objeto
 
     ////////////////////////////////////////////////////////////
-    /// \brief Cosntrutor padro.
+    /// \brief Cosntrutor padrão.
     /// 
     ////////////////////////////////////////////////////////////
     Entity();
@@ -50,7 +50,7 @@ public:
     ////////////////////////////////////////////////////////////
     /// \brief Desenha objetos derivados desta classe.
     /// 
-    /// Mtodo virtual chamado a cada frame para desenhar objetos.
+    /// Método virtual chamado a cada frame para desenhar objetos.
     /// Deve ser implementado pelas classes derivadas.
     /// 
     ////////////////////////////////////////////////////////////
@@ -59,48 +59,48 @@ public:
     ////////////////////////////////////////////////////////////
     /// \brief Define a tag associada ao objeto.
     ///
-    /// A tag  uma string que pode ser usada para agrupar ou identificar
-    /// objetos, permitindo a categorizao de mltiplos objetos sob a mesma tag.
-    /// Ao contrrio do ID, que  nico para cada objeto,
-    /// a mesma tag pode ser compartilhada entre vrios objetos.
+    /// A tag é uma string que pode ser usada para agrupar ou identificar
+    /// objetos, permitindo a categorização de múltiplos objetos sob a mesma tag.
+    /// Ao contrário do ID, que é único para cada objeto,
+    /// a mesma tag pode ser compartilhada entre vários objetos.
     ///
     /// \param tag A string contendo a nova tag do objeto. Se for
-    /// nullptr ou uma string vazia, a tag do objeto ser removida
-    /// ou resetada para o valor padro.
+    /// nullptr ou uma string vazia, a tag do objeto será removida
+    /// ou resetada para o valor padrão.
     ///
     ////////////////////////////////////////////////////////////
     void Tag(const char* tag);
 
     ////////////////////////////////////////////////////////////
-    /// \brief Destri esta entidade.
+    /// \brief Destrói esta entidade.
     ///
-    /// Este mtodo remove e destri a entidade do sistema. Coloca
-    /// a entidade num vetor para destruio ao termino do processamento
+    /// Este método remove e destrói a entidade do sistema. Coloca
+    /// a entidade num vetor para destruição ao termino do processamento
     /// de todas entidades instanciadas, liberando os recursos alocados.
-    /// Aps a destruio, a entidade no pode mais ser usada.
+    /// Após a destruição, a entidade não pode mais ser usada.
     ///
     ////////////////////////////////////////////////////////////
     void Destroy();
 
     ////////////////////////////////////////////////////////////
-    /// \brief Adiciona um componente  entidade.
+    /// \brief Adiciona um componente à entidade.
     ///
-    /// Este mtodo cria e adiciona um novo componente do tipo `T` 
-    ///  entidade, passando os argumentos fornecidos para o
-    /// construtor do componente. A entidade  associada ao componente.
+    /// Este método cria e adiciona um novo componente do tipo `T` 
+    /// à entidade, passando os argumentos fornecidos para o
+    /// construtor do componente. A entidade é associada ao componente.
     ///
     /// \tparam Args Tipos dos argumentos a serem passados para o construtor do componente.
     /// 
-    /// \return Um ponteiro para o componente recm-adicionado.
+    /// \return Um ponteiro para o componente recém-adicionado.
     ///
     ////////////////////////////////////////////////////////////
     template<typename T, typename... Args>
     T* AddComponent(Args&&... args);
 
     ////////////////////////////////////////////////////////////
-    /// \brief Obtm um componente da entidade atual.
+    /// \brief Obtém um componente da entidade atual.
     ///
-    /// Este mtodo recupera um componente do tipo `T` associado  
+    /// Este método recupera um componente do tipo `T` associado à 
     /// entidade atual.
     ///
     /// \tparam T O tipo de componente a ser obtido.
@@ -112,7 +112,7 @@ public:
     T* GetComponent();
 
 protected:
-    static Window& window;    ///< Referencia para a janela grfica.
+    static Window& window;    ///< Referencia para a janela gráfica.
     static float&  deltaTime; ///< Tempo decorrido entre frames
 
 private:
@@ -130,8 +130,8 @@ private:
     ////////////////////////////////////////////////////////////
     /// \brief Atualiza todos os componentes da classe.
     /// 
-    /// Mtodo para atualizar o estado dos componentes.
-    ///  chamado logo aps o Update dos Objetos.
+    /// Método para atualizar o estado dos componentes.
+    /// É chamado logo após o Update dos Objetos.
     /// 
     ////////////////////////////////////////////////////////////
     void UpdateComponents();
@@ -139,8 +139,8 @@ private:
     ////////////////////////////////////////////////////////////
     /// \brief Desenha todos os componentes da entidade.
     /// 
-    /// Mtodo para desenhar os componentes do objeto.
-    ///  chamado logo aps o Draw dos Objetos.
+    /// Método para desenhar os componentes do objeto.
+    /// É chamado logo após o Draw dos Objetos.
     /// 
     ////////////////////////////////////////////////////////////
     void DrawComponents();
@@ -148,8 +148,8 @@ private:
     ////////////////////////////////////////////////////////////
     /// \brief Inicializa objetos derivados desta classe.
     /// 
-    /// Mtodo virtual chamado uma vez no mesmo frame em que o objeto
-    ///  instanciado, logo aps sua varivel `scene` ser inicializada.
+    /// Método virtual chamado uma vez no mesmo frame em que o objeto
+    /// é instanciado, logo após sua variável `scene` ser inicializada.
     /// Deve ser implementado pelas classes derivadas.
     /// 
     ////////////////////////////////////////////////////////////
@@ -158,8 +158,8 @@ private:
     ////////////////////////////////////////////////////////////
     /// \brief Inicializa objetos derivados desta classe.
     /// 
-    /// Mtodo virtual chamado uma vez no prximo frame aps a
-    /// criao do objeto.
+    /// Método virtual chamado uma vez no próximo frame após a
+    /// criação do objeto.
     /// Deve ser implementado pelas classes derivadas.
     /// 
     ////////////////////////////////////////////////////////////
@@ -168,21 +168,21 @@ private:
     ////////////////////////////////////////////////////////////
     /// \brief Atualiza objetos derivados desta classe.
     /// 
-    /// Mtodo virtual chamado a cada frame para atualizar objetos.
+    /// Método virtual chamado a cada frame para atualizar objetos.
     /// Deve ser implementado pelas classes derivadas.
     /// 
     ////////////////////////////////////////////////////////////
     virtual void Update() {};
 
     ////////////////////////////////////////////////////////////
-    /// \brief Lida com colises entre esta entidade e outra.
+    /// \brief Lida com colisões entre esta entidade e outra.
     ///
-    /// Este mtodo virtual  chamado automaticamente quando h uma
-    /// coliso entre esta entidade e outra entidade do jogo. Pode ser
+    /// Este método virtual é chamado automaticamente quando há uma
+    /// colisão entre esta entidade e outra entidade do jogo. Pode ser
     /// sobrescrito nas classes derivadas para implementar comportamentos
-    /// especficos de coliso.
+    /// específicos de colisão.
     /// 
-    /// \param obj Uma referncia para a entidade que colidiu com esta.
+    /// \param obj Uma referência para a entidade que colidiu com esta.
     ///
     ////////////////////////////////////////////////////////////
     virtual void OnCollision(Entity& obj) {};
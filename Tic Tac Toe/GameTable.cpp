@@ -0,0 +1,114 @@
+#include "GameTable.h"
+
+//--------------------------------------------------------------------------------------------------
+
+namespace
+{
+    using Mask  = Board::Mask;
+    using Entry = GameTable::Entry;
+    using Table = std::array<Entry, GameTable::Positions>;
+
+    // Valor em base 3 de cada máscara de 9 bits (casa i vale 3^i)
+    constexpr std::array<int, Board::Full + 1> ternary{ [] {
+        std::array<int, Board::Full + 1> digits{};
+
+        for (int mask{}; mask <= Board::Full; ++mask)
+        {
+            for (int square{}, power{ 1 }; square < Board::Size; ++square, power *= 3)
+            {
+                if (mask & (1 << square))
+                    digits[mask] += power;
+            }
+        }
+
+        return digits;
+    }() };
+
+    //----------------------------------------------------------------------------------------------
+
+    constexpr int Index(Mask o, Mask x)
+    {
+        return ternary[o] + 2 * ternary[x];
+    }
+
+    //----------------------------------------------------------------------------------------------
+
+    // Negamax com memorização: 'mover' é quem joga e 'other' quem acabou de jogar
+    constexpr int Solve(Table& table, Mask mover, Mask other, bool xToMove)
+    {
+        Entry& entry{ table[xToMove ? Index(other, mover) : Index(mover, other)] };
+
+        if (entry.reachable)
+            return entry.value;
+
+        entry.reachable = true;
+        entry.move = -1;
+
+        // Se o adversário venceu ou há empate (estado terminal), retorna utilidade
+        if (Board::HasLine(other))
+            return entry.value = -10;
+
+        Mask moves{ Mask(~(mover | other) & Board::Full) };
+
+        if (moves == 0)
+            return entry.value = 0;
+
+        int bestValue{ -100 };
+
+        for (; moves; moves &= moves - 1)
+        {
+            const int move{ std::countr_zero(moves) };
+
+            // Valor da jogada, descontando um lance em direção ao empate
+            int value{ -Solve(table, other, Mask(mover | (1 << move)), !xToMove) };
+            value -= (value > 0) - (value < 0);
+
+            // Em caso de empate mantém a primeira jogada, como no Minimax recursivo
+            if (value > bestValue)
+            {
+                bestValue = value;
+                entry.move = int8_t(move);
+            }
+        }
+
+        return entry.value = int8_t(bestValue);
+    }
+
+    //----------------------------------------------------------------------------------------------
+
+    constexpr Table Generate()
+    {
+        Table table{};
+        Solve(table, 0, 0, true);
+        return table;
+    }
+
+    //----------------------------------------------------------------------------------------------
+
+    constexpr Table table{ Generate() };
+
+    static_assert([] {
+        int count{};
+        for (const Entry& entry : table)
+            count += entry.reachable;
+        return count;
+    }() == GameTable::Reachable);
+}
+
+//--------------------------------------------------------------------------------------------------
+
+GameTable::Entry GameTable::Lookup(const Board& board, Player player)
+{
+    const Mask o{ board.Occupied(Player::O) };
+    const Mask x{ board.Occupied(Player::X) };
+
+    // A tabela assume que X começa; se for a vez do outro jogador, troca as cores
+    const bool xToMove{ std::popcount(x) == std::popcount(o) };
+
+    if ((player == Player::X) == xToMove)
+        return table[Index(o, x)];
+
+    return table[Index(x, o)];
+}
+
+//--------------------------------------------------------------------------------------------------
@@ -0,0 +1,28 @@
+#ifndef QUANTVERSO_GAMETABLE_H
+#define QUANTVERSO_GAMETABLE_H
+
+//--------------------------------------------------------------------------------------------------
+
+#include "Board.h"
+
+//--------------------------------------------------------------------------------------------------
+
+class GameTable
+{
+public:
+    struct Entry
+    {
+        int8_t value;     // Utilidade para o jogador da vez: ±(10 - lances até o fim) ou 0 (empate)
+        int8_t move;      // Melhor jogada (-1 em posições terminais ou inalcançáveis)
+        bool   reachable; // Posição alcançável a partir do tabuleiro vazio
+    };
+
+    static constexpr int Positions{ 19683 }; // 3^9 codificações do tabuleiro
+    static constexpr int Reachable{ 5478 };  // Posições legais (X começa)
+
+    static Entry Lookup(const Board& board, Player player);
+};
+
+//--------------------------------------------------------------------------------------------------
+
+#endif
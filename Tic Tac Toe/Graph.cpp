@@ -0,0 +1,389 @@
+#include "Graph.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+//--------------------------------------------------------------------------------------------------
+
+MCTS::Graph::~Graph()
+{
+	Cancel();
+}
+
+//--------------------------------------------------------------------------------------------------
+
+void MCTS::Graph::Search(Board& board, int iterations, float explorationConstant)
+{
+	Execute(board, iterations, Time::max(), explorationConstant);
+}
+
+//--------------------------------------------------------------------------------------------------
+
+void MCTS::Graph::SearchFor(Board& board, float milliseconds, float explorationConstant)
+{
+	const Time deadline{ high_resolution_clock::now() + duration_cast<Time::duration>(duration<float, std::milli>(milliseconds)) };
+	Execute(board, std::numeric_limits<int>::max(), deadline, explorationConstant);
+}
+
+//--------------------------------------------------------------------------------------------------
+
+void MCTS::Graph::SearchAsync(const Board& board, float milliseconds, float explorationConstant)
+{
+	Cancel();
+
+	// A busca roda em outra thread sobre uma cópia do tabuleiro
+	pending = std::async(std::launch::async, [this, board, milliseconds, explorationConstant] {
+		Board result{ board };
+		SearchFor(result, milliseconds, explorationConstant);
+		return result;
+	});
+}
+
+//--------------------------------------------------------------------------------------------------
+
+void MCTS::Graph::SearchAsync(const Board& board, int iterations, float explorationConstant)
+{
+	Cancel();
+
+	pending = std::async(std::launch::async, [this, board, iterations, explorationConstant] {
+		Board result{ board };
+		Search(result, iterations, explorationConstant);
+		return result;
+	});
+}
+
+//--------------------------------------------------------------------------------------------------
+
+bool MCTS::Graph::Poll(Board& board)
+{
+	// Retorna a jogada apenas quando a busca em segundo plano termina
+	if (!pending.valid() || pending.wait_for(seconds(0)) != std::future_status::ready)
+		return false;
+
+	board = pending.get();
+	return true;
+}
+
+//--------------------------------------------------------------------------------------------------
+
+bool MCTS::Graph::IsSearching() const
+{
+	return pending.valid();
+}
+
+//--------------------------------------------------------------------------------------------------
+
+void MCTS::Graph::Cancel()
+{
+	if (!pending.valid())
+		return;
+
+	// Interrompe a busca e descarta o resultado
+	stop = true;
+	pending.wait();
+	pending = {};
+	stop = false;
+}
+
+//--------------------------------------------------------------------------------------------------
+
+void MCTS::Graph::Execute(Board& board, int iterations, Time deadline, float explorationConstant)
+{
+	// A posição atual pode já estar no grafo, vinda de buscas anteriores por qualquer ordem de jogadas
+	int symmetry;
+	const uint64_t key{ Board::CanonicalKey(board.SymmetricHashes(), symmetry) };
+	root = Insert(board, key);
+
+	// Orientação do nó encontrado em relação ao tabuleiro real
+	for (symmetry = 0; symmetry < Board::Symmetries && nodes[root].board.Transformed(symmetry) != board; ++symmetry);
+
+	// Colisão de chaves: recomeça com um grafo vazio
+	if (symmetry == Board::Symmetries)
+	{
+		Clear();
+		root = Insert(board, key);
+		symmetry = 0;
+	}
+
+	completed = 0;
+	Run(iterations, deadline, explorationConstant);
+
+	const uint32_t selected{ Best(root) };
+
+	if (selected != Node::Null)
+		board.MakeMove(Board::TransformSquare(edges[selected].move, symmetry));
+}
+
+//--------------------------------------------------------------------------------------------------
+
+void MCTS::Graph::Clear()
+{
+	nodes.Clear();
+	edges.Clear();
+	std::fill(table.begin(), table.end(), Slot{ 0, Node::Null });
+	root = Node::Null;
+}
+
+//--------------------------------------------------------------------------------------------------
+
+void MCTS::Graph::Seed(uint32_t seed)
+{
+	random.Seed(seed);
+}
+
+//--------------------------------------------------------------------------------------------------
+
+void MCTS::Graph::SetRollouts(int count)
+{
+	rollouts = std::max(1, count);
+}
+
+//--------------------------------------------------------------------------------------------------
+
+uint32_t MCTS::Graph::Size() const
+{
+	return nodes.Size();
+}
+
+//--------------------------------------------------------------------------------------------------
+
+int MCTS::Graph::Iterations() const
+{
+	return completed;
+}
+
+//--------------------------------------------------------------------------------------------------
+
+void MCTS::Graph::GetRootStatistics(std::vector<Statistics>& statistics) const
+{
+	statistics.clear();
+
+	if (root == Node::Null || nodes[root].firstChild == Node::Null)
+		return;
+
+	const Vertex& node{ nodes[root] };
+
+	// Visitas da aresta com a média do filho, que inclui as simulações vindas por transposição
+	for (uint32_t adj{ node.firstChild }; adj < node.firstChild + node.childCount; ++adj)
+	{
+		const Edge& edge{ edges[adj] };
+		const Vertex& child{ nodes[edge.child] };
+		const float mean{ child.visits ? child.score / child.visits : 0.f };
+
+		statistics.push_back({ edge.move, edge.visits, mean * edge.visits });
+	}
+}
+
+//--------------------------------------------------------------------------------------------------
+
+void MCTS::Graph::Run(int iterations, Time deadline, float explorationConstant)
+{
+	for (; completed < iterations; ++completed)
+	{
+		// Consulta o relógio periodicamente para respeitar o orçamento de tempo
+		if (completed % CheckInterval == 0 && (stop.load(std::memory_order_relaxed) || (deadline != Time::max() && high_resolution_clock::now() >= deadline)))
+			break;
+
+		uint32_t index{ root };
+		int depth{};
+
+		// Desce até um nó nunca simulado; nós já visitados por outro caminho continuam a descida
+		while (!nodes[index].isTerminal)
+		{
+			const uint32_t edge{ Select(index, explorationConstant) };
+
+			path[depth++] = edge;
+			index = edges[edge].child;
+
+			if (nodes[index].visits == 0)
+				break;
+		}
+
+		Backpropagate(depth, Node::Rollout(nodes[index].board, random, rollouts));
+	}
+}
+
+//--------------------------------------------------------------------------------------------------
+
+uint32_t MCTS::Graph::Select(uint32_t index, float explorationConstant)
+{
+	if (nodes[index].firstChild == Node::Null)
+		Expand(index);
+
+	Vertex& node{ nodes[index] };
+	const uint32_t first{ node.firstChild };
+
+	// Caso haja arestas não exploradas, retorna a próxima delas
+	if (node.explored < node.childCount)
+		return first + node.explored++;
+
+	float bestValue{ -std::numeric_limits<float>::infinity() };
+	uint32_t best{ first };
+	uint32_t ties{};
+
+	const float logVisits{ std::logf(float(node.visits)) };
+
+	// UCB1 com a média do nó filho e as visitas da aresta
+	for (uint32_t adj{ first }, end{ first + node.childCount }; adj < end; ++adj)
+	{
+		const Edge& edge{ edges[adj] };
+		const Vertex& child{ nodes[edge.child] };
+
+		const float exploitation{ (node.board.Turn() == Player::O ? child.score : -child.score) / child.visits };
+		const float exploration{ explorationConstant * std::sqrtf(logVisits / edge.visits) };
+		const float ucbValue{ exploitation + exploration };
+
+		if (ucbValue > bestValue)
+		{
+			ties = 0;
+			bestValue = ucbValue;
+		}
+
+		if (std::fabs(ucbValue - bestValue) < 1e-6f && random.Below(++ties) == 0)
+			best = adj;
+	}
+
+	return best;
+}
+
+//--------------------------------------------------------------------------------------------------
+
+uint32_t MCTS::Graph::Best(uint32_t index)
+{
+	const Vertex& node{ nodes[index] };
+
+	if (node.isTerminal || node.firstChild == Node::Null)
+		return Node::Null;
+
+	float bestValue{ -std::numeric_limits<float>::infinity() };
+	uint32_t best{ Node::Null };
+	uint32_t ties{};
+
+	// Melhor média da perspectiva do jogador da vez entre as arestas visitadas
+	for (uint32_t adj{ node.firstChild }, end{ node.firstChild + node.childCount }; adj < end; ++adj)
+	{
+		const Edge& edge{ edges[adj] };
+		const Vertex& child{ nodes[edge.child] };
+
+		if (edge.visits == 0)
+			continue;
+
+		const float value{ (node.board.Turn() == Player::O ? child.score : -child.score) / child.visits };
+
+		if (value > bestValue)
+		{
+			ties = 0;
+			bestValue = value;
+		}
+
+		if (std::fabs(value - bestValue) < 1e-6f && random.Below(++ties) == 0)
+			best = adj;
+	}
+
+	return best;
+}
+
+//--------------------------------------------------------------------------------------------------
+
+void MCTS::Graph::Expand(uint32_t index)
+{
+	Vertex& node{ nodes[index] };
+	const Player player{ node.board.Turn() };
+	Board board{ node.board };
+
+	// Apenas uma jogada por classe de simetria; os hashes das imagens são atualizados por jogada
+	const Board::Mask moves{ board.DistinctMoves() };
+	const uint32_t count{ uint32_t(std::popcount(moves)) };
+	const Board::Hashes hashes{ board.SymmetricHashes() };
+
+	const uint32_t first{ edges.Allocate(count) };
+	uint32_t adj{ first };
+
+	for (Board::Mask remaining{ moves }; remaining; remaining &= remaining - 1)
+	{
+		const int move{ std::countr_zero(remaining) };
+
+		Board::Hashes next{ hashes };
+		Board::Toggle(next, move, player);
+
+		int symmetry;
+		const uint64_t key{ Board::CanonicalKey(next, symmetry) };
+
+		board.MakeMove(move);
+		edges[adj++] = Edge{ Insert(board, key), int8_t(move), 0 };
+		board.UnmakeMove();
+	}
+
+	node.firstChild = first;
+	node.childCount = uint8_t(count);
+}
+
+//--------------------------------------------------------------------------------------------------
+
+void MCTS::Graph::Backpropagate(int depth, float score)
+{
+	// Atualiza a raiz e cada aresta do caminho junto com o nó a que ela leva
+	nodes[root].visits++;
+	nodes[root].score += score;
+
+	for (int i{}; i < depth; ++i)
+	{
+		Edge& edge{ edges[path[i]] };
+		Vertex& child{ nodes[edge.child] };
+
+		edge.visits++;
+		child.visits++;
+		child.score += score;
+	}
+}
+
+//--------------------------------------------------------------------------------------------------
+
+uint32_t MCTS::Graph::Insert(const Board& board, uint64_t key)
+{
+	// Mantém a ocupação da tabela abaixo da metade
+	if (2 * (nodes.Size() + 1) > table.size())
+		Grow();
+
+	const size_t mask{ table.size() - 1 };
+
+	for (size_t slot{ key & mask };; slot = (slot + 1) & mask)
+	{
+		if (table[slot].index == Node::Null)
+		{
+			const uint32_t index{ nodes.Allocate(1) };
+			const bool isTerminal{ board.CheckWinner() != Player::None || board.Available() == 0 };
+			nodes[index] = Vertex{ board, Node::Null, 0, 0, isTerminal, 0, 0.f };
+			table[slot] = { key, index };
+			return index;
+		}
+
+		if (table[slot].key == key)
+			return table[slot].index;
+	}
+}
+
+//--------------------------------------------------------------------------------------------------
+
+void MCTS::Graph::Grow()
+{
+	std::vector<Slot> old(std::max<size_t>(1024, 2 * table.size()), Slot{ 0, Node::Null });
+	std::swap(table, old);
+
+	const size_t mask{ table.size() - 1 };
+
+	// Reinsere as entradas existentes na tabela maior
+	for (const Slot& entry : old)
+	{
+		if (entry.index == Node::Null)
+			continue;
+
+		size_t slot{ entry.key & mask };
+		while (table[slot].index != Node::Null)
+			slot = (slot + 1) & mask;
+
+		table[slot] = entry;
+	}
+}
+
+//--------------------------------------------------------------------------------------------------
@@ -0,0 +1,104 @@
+#ifndef QUANTVERSO_GRAPH_H
+#define QUANTVERSO_GRAPH_H
+
+//--------------------------------------------------------------------------------------------------
+
+#include "MCTS.h"
+
+//--------------------------------------------------------------------------------------------------
+
+namespace MCTS
+{
+	////////////////////////////////////////////////////////////
+	/// class Graph
+	/// \brief MCTS sobre o grafo de posições (UCT em DAG).
+	///
+	/// Cada posição, a menos de simetria, é um único nó,
+	/// encontrado pela chave canônica de Zobrist numa tabela
+	/// de endereçamento aberto. Ordens de jogadas diferentes
+	/// levam ao mesmo nó e somam as suas estatísticas.
+	///
+	/// As arestas guardam as próprias visitas: a exploração
+	/// usa as visitas da aresta e o aproveitamento a média do
+	/// nó filho, compartilhada entre todos os pais. O grafo é
+	/// mantido entre buscas até Clear().
+	///
+	/// Como a árvore, pode buscar em segundo plano: a jogada é
+	/// lida por Poll() num quadro posterior. As demais funções
+	/// só podem ser chamadas sem busca pendente.
+	///
+	////////////////////////////////////////////////////////////
+	class Graph
+	{
+	public:
+		~Graph();
+
+		void Search(Board& board, int iterations, float explorationConstant);
+		void SearchFor(Board& board, float milliseconds, float explorationConstant);
+		void SearchAsync(const Board& board, float milliseconds, float explorationConstant);
+		void SearchAsync(const Board& board, int iterations, float explorationConstant);
+		bool Poll(Board& board);
+		bool IsSearching() const;
+		void Cancel();
+		void Clear();
+		void Seed(uint32_t seed);
+		void SetRollouts(int count);
+		uint32_t Size() const;
+		int Iterations() const;
+		void GetRootStatistics(std::vector<Statistics>& statistics) const;
+
+	private:
+		// Ao contrário da árvore, o nó guarda o tabuleiro: chega-se a ele por vários caminhos, em
+		// orientações diferentes, e as jogadas das arestas valem para a orientação em que foi criado
+		struct Vertex
+		{
+			Board    board;
+			uint32_t firstChild;  // Node::Null enquanto não expandido
+			uint8_t  childCount;
+			uint8_t  explored;    // Arestas já visitadas ao menos uma vez
+			bool     isTerminal;
+			int      visits;
+			float    score;
+		};
+
+		struct Edge
+		{
+			uint32_t child;
+			int8_t   move;   // Jogada na orientação do tabuleiro do nó de origem
+			int      visits;
+		};
+
+		struct Slot
+		{
+			uint64_t key;
+			uint32_t index;  // Node::Null se vazio
+		};
+
+		static constexpr int CheckInterval{ 64 }; // Iterações entre consultas ao relógio
+
+		void Execute(Board& board, int iterations, Time deadline, float explorationConstant);
+		void Run(int iterations, Time deadline, float explorationConstant);
+		uint32_t Select(uint32_t index, float explorationConstant);
+		uint32_t Best(uint32_t index);
+		void Expand(uint32_t index);
+		void Backpropagate(int depth, float score);
+		uint32_t Insert(const Board& board, uint64_t key);
+		void Grow();
+
+		Arena<Vertex>                     nodes;
+		Arena<Edge>                       edges;          // Arestas de cada nó contíguas: [firstChild, firstChild + childCount)
+		std::vector<Slot>                 table;          // Chave canônica -> nó, sondagem linear
+		std::array<uint32_t, Board::Size> path;           // Arestas percorridas na iteração atual
+		uint32_t                          root{ Node::Null };
+		Random                            random{ std::random_device{}() };
+		int                               rollouts{ 1 };  // Simulações por folha
+		int                               completed{};    // Iterações feitas pela última busca
+
+		std::future<Board>                pending;        // Busca em segundo plano
+		std::atomic<bool>                 stop{};         // Pedido de interrupção da busca
+	};
+}
+
+//--------------------------------------------------------------------------------------------------
+
+#endif
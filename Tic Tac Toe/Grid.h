@@ -0,0 +1,212 @@
+#ifndef QUANTVERSO_GRID_H
+#define QUANTVERSO_GRID_H
+
+//--------------------------------------------------------------------------------------------------
+
+#include "Board.h"
+#include "Bitset.h"
+
+//--------------------------------------------------------------------------------------------------
+
+////////////////////////////////////////////////////////////
+/// class Grid
+/// \brief Tabuleiro m,n,k: M linhas, N colunas, K em linha vence.
+///
+/// Todas as dimensões são constantes de compilação. A vitória
+/// é verificada apenas nas quatro linhas que passam pela
+/// última pedra colocada, em O(K) por jogada.
+///
+////////////////////////////////////////////////////////////
+template <int M, int N, int K>
+class Grid
+{
+    static_assert(M > 0 && N > 0 && K > 1 && (K <= M || K <= N), "Dimensoes invalidas para um jogo m,n,k");
+
+public:
+    static constexpr int Rows{ M };
+    static constexpr int Columns{ N };
+    static constexpr int Length{ K };
+    static constexpr int Size{ M * N };
+
+    using Moves = Bitset<Size>;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Coloca uma pedra e verifica a vitória pela casa.
+    ///
+    /// \return true se a jogada completou K em linha.
+    ///
+    ////////////////////////////////////////////////////////////
+    bool Play(int square, Player player);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Remove a pedra da casa (desfaz a última jogada).
+    ///
+    ////////////////////////////////////////////////////////////
+    void Undo(int square);
+
+    Player Winner() const;
+    bool IsTerminal() const;
+    Moves Available() const;
+    const Moves& Occupied(Player player) const;
+    Player Get(int square) const;
+    int Stones() const;
+    uint64_t Hash() const;
+
+    bool operator==(const Grid& other) const = default;
+
+private:
+    // Chaves de Zobrist: [jogador][casa]
+    static constexpr std::array<uint64_t, 2 * Size> zobrist{ [] {
+        std::array<uint64_t, 2 * Size> keys{};
+
+        // SplitMix64 com semente fixa
+        uint64_t state{ 0x2545F4914F6CDD1D };
+        for (auto& key : keys)
+        {
+            uint64_t z{ state += 0x9E3779B97F4A7C15 };
+            z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9;
+            z = (z ^ (z >> 27)) * 0x94D049BB133111EB;
+            key = z ^ (z >> 31);
+        }
+
+        return keys;
+    }() };
+
+    int Run(const Moves& own, int row, int col, int rowStep, int colStep) const;
+
+    static int Index(Player player);
+
+    // Ocupação de cada jogador: [0] = O, [1] = X
+    std::array<Moves, 2> stones{};
+    Player               winner{};
+    int                  count{};
+    uint64_t             hash{};
+};
+
+//--------------------------------------------------------------------------------------------------
+
+// Cinco em linha no tabuleiro 15x15
+using Gomoku = Grid<15, 15, 5>;
+
+//--------------------------------------------------------------------------------------------------
+
+template <int M, int N, int K>
+inline int Grid<M, N, K>::Index(Player player)
+{
+    return player == Player::X;
+}
+
+//--------------------------------------------------------------------------------------------------
+
+template <int M, int N, int K>
+inline bool Grid<M, N, K>::Play(int square, Player player)
+{
+    Moves& own{ stones[Index(player)] };
+
+    own.Set(square);
+    hash ^= zobrist[Index(player) * Size + square];
+    count++;
+
+    // Conta as pedras contíguas nas quatro direções que passam pela casa
+    const int row{ square / N }, col{ square % N };
+
+    if (1 + Run(own, row, col, 0, 1) + Run(own, row, col, 0, -1) >= K ||
+        1 + Run(own, row, col, 1, 0) + Run(own, row, col, -1, 0) >= K ||
+        1 + Run(own, row, col, 1, 1) + Run(own, row, col, -1, -1) >= K ||
+        1 + Run(own, row, col, 1, -1) + Run(own, row, col, -1, 1) >= K)
+        winner = player;
+
+    return winner == player;
+}
+
+//--------------------------------------------------------------------------------------------------
+
+template <int M, int N, int K>
+inline void Grid<M, N, K>::Undo(int square)
+{
+    const int index{ Index(Get(square)) };
+
+    stones[index].Reset(square);
+    hash ^= zobrist[index * Size + square];
+    count--;
+
+    // O jogo termina na jogada vencedora; antes dela não havia vencedor
+    winner = Player::None;
+}
+
+//--------------------------------------------------------------------------------------------------
+
+template <int M, int N, int K>
+inline int Grid<M, N, K>::Run(const Moves& own, int row, int col, int rowStep, int colStep) const
+{
+    // Nunca é preciso olhar além de K - 1 casas em cada sentido
+    int length{};
+
+    for (row += rowStep, col += colStep; length < K - 1; row += rowStep, col += colStep, ++length)
+    {
+        if (row < 0 || row >= M || col < 0 || col >= N || !own.Test(row * N + col))
+            break;
+    }
+
+    return length;
+}
+
+//--------------------------------------------------------------------------------------------------
+
+template <int M, int N, int K>
+inline Player Grid<M, N, K>::Winner() const
+{
+    return winner;
+}
+
+//--------------------------------------------------------------------------------------------------
+
+template <int M, int N, int K>
+inline bool Grid<M, N, K>::IsTerminal() const
+{
+    return winner != Player::None || count == Size;
+}
+
+//--------------------------------------------------------------------------------------------------
+
+template <int M, int N, int K>
+inline typename Grid<M, N, K>::Moves Grid<M, N, K>::Available() const
+{
+    return ~(stones[0] | stones[1]);
+}
+
+//--------------------------------------------------------------------------------------------------
+
+template <int M, int N, int K>
+inline const typename Grid<M, N, K>::Moves& Grid<M, N, K>::Occupied(Player player) const
+{
+    return stones[Index(player)];
+}
+
+//--------------------------------------------------------------------------------------------------
+
+template <int M, int N, int K>
+inline Player Grid<M, N, K>::Get(int square) const
+{
+    return stones[0].Test(square) ? Player::O : stones[1].Test(square) ? Player::X : Player::None;
+}
+
+//--------------------------------------------------------------------------------------------------
+
+template <int M, int N, int K>
+inline int Grid<M, N, K>::Stones() const
+{
+    return count;
+}
+
+//--------------------------------------------------------------------------------------------------
+
+template <int M, int N, int K>
+inline uint64_t Grid<M, N, K>::Hash() const
+{
+    return hash;
+}
+
+//--------------------------------------------------------------------------------------------------
+
+#endif
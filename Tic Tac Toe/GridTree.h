@@ -0,0 +1,233 @@
+#ifndef QUANTVERSO_GRIDTREE_H
+#define QUANTVERSO_GRIDTREE_H
+
+//--------------------------------------------------------------------------------------------------
+
+#include "Grid.h"
+#include "Arena.h"
+#include "Random.h"
+#include <cmath>
+#include <limits>
+#include <random>
+
+//--------------------------------------------------------------------------------------------------
+
+namespace MCTS
+{
+	////////////////////////////////////////////////////////////
+	/// class GridTree
+	/// \brief UCT sobre um tabuleiro m,n,k.
+	///
+	/// Os nós não guardam o tabuleiro: as jogadas são refeitas
+	/// sobre uma cópia da raiz durante a descida, e a vitória
+	/// é detectada pela última pedra colocada.
+	///
+	////////////////////////////////////////////////////////////
+	template <int M, int N, int K>
+	class GridTree
+	{
+	public:
+		using Game = Grid<M, N, K>;
+
+		////////////////////////////////////////////////////////////
+		/// \brief Executa a busca a partir de `grid` com `player` na vez.
+		///
+		/// \return Jogada mais visitada da raiz (-1 se terminal).
+		///
+		////////////////////////////////////////////////////////////
+		int Search(const Game& grid, Player player, int iterations, float explorationConstant);
+		void Clear();
+		void Seed(uint32_t seed);
+
+	private:
+		static_assert(Game::Size <= std::numeric_limits<int16_t>::max(), "Tabuleiro grande demais para os indices dos nos");
+
+		static constexpr uint32_t Null{ ~0u };
+
+		struct Node
+		{
+			uint32_t parent;
+			uint32_t firstChild;	// Filhos contíguos na arena: [firstChild, firstChild + childCount)
+			uint16_t childCount;
+			uint16_t explored;		// Filhos já visitados ao menos uma vez
+			int16_t  move;			// Jogada que levou a este nó
+			Player   player;		// Jogador que fez a jogada
+			int      visits;
+			float    score;			// Soma dos resultados da perspectiva de `player`
+		};
+
+		bool Expand(uint32_t index, const Game& grid, Player player);
+		uint32_t Select(uint32_t index, float explorationConstant);
+		Player Rollout(Game& grid, Player player);
+		void Backpropagate(uint32_t index, Player winner);
+
+		Arena<Node>  nodes;
+		Random       random{ std::random_device{}() };
+	};
+
+	//----------------------------------------------------------------------------------------------
+
+	template <int M, int N, int K>
+	inline int GridTree<M, N, K>::Search(const Game& grid, Player player, int iterations, float explorationConstant)
+	{
+		if (grid.IsTerminal())
+			return -1;
+
+		Clear();
+		nodes[nodes.Allocate(1)] = Node{ Null, Null, 0, 0, -1, Player(-player), 0, 0.f };
+
+		for (int i{}; i < iterations; ++i)
+		{
+			Game game{ grid };
+			Player next{ player };
+			uint32_t index{};
+
+			// Seleção e expansão: desce até um filho ainda não visitado ou um estado terminal
+			while (!game.IsTerminal())
+			{
+				Node& node{ nodes[index] };
+
+				// Arena cheia: a simulação parte da folha atual
+				if (node.firstChild == Null && !Expand(index, game, next))
+					break;
+
+				index = node.explored < node.childCount ? node.firstChild + node.explored++ : Select(index, explorationConstant);
+
+				game.Play(nodes[index].move, next);
+				next = Player(-next);
+
+				if (nodes[index].visits == 0)
+					break;
+			}
+
+			// Simulação e retropropagação
+			const Player winner{ game.IsTerminal() ? game.Winner() : Rollout(game, next) };
+			Backpropagate(index, winner);
+		}
+
+		// Escolhe a jogada mais visitada
+		const Node& root{ nodes[0] };
+		int bestMove{ -1 }, bestVisits{ -1 };
+
+		for (uint32_t child{ root.firstChild }; child < root.firstChild + root.childCount; ++child)
+		{
+			if (nodes[child].visits > bestVisits)
+			{
+				bestVisits = nodes[child].visits;
+				bestMove = nodes[child].move;
+			}
+		}
+
+		return bestMove;
+	}
+
+	//----------------------------------------------------------------------------------------------
+
+	template <int M, int N, int K>
+	inline void GridTree<M, N, K>::Clear()
+	{
+		nodes.Clear();
+	}
+
+	//----------------------------------------------------------------------------------------------
+
+	template <int M, int N, int K>
+	inline void GridTree<M, N, K>::Seed(uint32_t seed)
+	{
+		random.Seed(seed);
+	}
+
+	//----------------------------------------------------------------------------------------------
+
+	template <int M, int N, int K>
+	inline bool GridTree<M, N, K>::Expand(uint32_t index, const Game& grid, Player player)
+	{
+		const typename Game::Moves moves{ grid.Available() };
+		const uint32_t count{ uint32_t(moves.Count()) };
+
+		// Os filhos são alocados de uma vez, contíguos na arena
+		const uint32_t first{ nodes.Allocate(count) };
+
+		if (first == Arena<Node>::Full)
+			return false;
+
+		uint32_t child{ first };
+
+		moves.ForEach([&](int square) {
+			nodes[child++] = Node{ index, Null, 0, 0, int16_t(square), player, 0, 0.f };
+		});
+
+		nodes[index].firstChild = first;
+		nodes[index].childCount = uint16_t(count);
+
+		return true;
+	}
+
+	//----------------------------------------------------------------------------------------------
+
+	template <int M, int N, int K>
+	inline uint32_t GridTree<M, N, K>::Select(uint32_t index, float explorationConstant)
+	{
+		const Node& node{ nodes[index] };
+		const float logVisits{ std::log(float(node.visits)) };
+
+		float bestValue{ -std::numeric_limits<float>::infinity() };
+		uint32_t best{ node.firstChild };
+
+		// Seleciona o filho mais promissor usando UCB1
+		for (uint32_t adj{ node.firstChild }, end{ node.firstChild + node.childCount }; adj < end; ++adj)
+		{
+			const Node& child{ nodes[adj] };
+			const float ucbValue{ child.score / child.visits + explorationConstant * std::sqrt(logVisits / child.visits) };
+
+			if (ucbValue > bestValue)
+			{
+				bestValue = ucbValue;
+				best = adj;
+			}
+		}
+
+		return best;
+	}
+
+	//----------------------------------------------------------------------------------------------
+
+	template <int M, int N, int K>
+	inline Player GridTree<M, N, K>::Rollout(Game& grid, Player player)
+	{
+		typename Game::Moves moves{ grid.Available() };
+
+		// Jogadas aleatórias sorteadas direto do conjunto de casas livres
+		for (int remaining{ moves.Count() }; remaining > 0; --remaining)
+		{
+			const int square{ moves.Select(int(random.Below(uint32_t(remaining)))) };
+			moves.Reset(square);
+
+			if (grid.Play(square, player))
+				return player;
+
+			player = Player(-player);
+		}
+
+		return Player::None;
+	}
+
+	//----------------------------------------------------------------------------------------------
+
+	template <int M, int N, int K>
+	inline void GridTree<M, N, K>::Backpropagate(uint32_t index, Player winner)
+	{
+		while (index != Null)
+		{
+			Node& node{ nodes[index] };
+
+			node.visits++;
+			node.score += winner == Player::None ? 0.f : winner == node.player ? 1.f : -1.f;
+			index = node.parent;
+		}
+	}
+}
+
+//--------------------------------------------------------------------------------------------------
+
+#endif
@@ -49,7 +49,7 @@ void Image::Load(const char* file)
 		SDL_Surface* converted{ SDL_ConvertSurfaceFormat(surface, SDL_PIXELFORMAT_RGBA32, 0) };
 		if (!converted)
 		{
-			std::cerr << "Falha ao converter a superfcie para 32 bits: " << SDL_GetError() << std::endl;
+			std::cerr << "Falha ao converter a superfície para 32 bits: " << SDL_GetError() << std::endl;
 			return;
 		}
 
@@ -69,7 +69,7 @@ Color Image::GetPixelColor(int x, int y) const
 
     if (!surface)
     {
-        std::cerr << "Falha ao acessar superfcie de imagem: " << IMG_GetError() << std::endl;
+        std::cerr << "Falha ao acessar superfície de imagem: " << IMG_GetError() << std::endl;
         return color;
     }
 
@@ -98,7 +98,7 @@ bool Image::ComparePixelColor(int x, int y, Color color, unsigned tolerance) con
 	// Cor do pixel
 	Color pixelColor{ GetPixelColor(x, y) };
 
-	// Diferena total entre componentes RGBA
+	// Diferença total entre componentes RGBA
 	int difference{
 		abs(pixelColor.r - color.r) +
 		abs(pixelColor.g - color.g) +
@@ -106,7 +106,7 @@ bool Image::ComparePixelColor(int x, int y, Color color, unsigned tolerance) con
 		abs(pixelColor.a - color.a)
 	};
 
-	// Compara a diferena total com o limite permitido pela tolerncia.
+	// Compara a diferença total com o limite permitido pela tolerância.
 	return difference <= ((4 * 255) * int(tolerance) / 100);
 }
 
@@ -1,30 +1,711 @@
 #include "MCTS.h"
-#include "Board.h"
-#include "Node.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <memory>
+#include <thread>
+
+//--------------------------------------------------------------------------------------------------
+
+namespace
+{
+	// Acesso atômico aos campos dos nós compartilhados entre threads
+	template <typename T>
+	std::atomic_ref<T> Atomic(T& value)
+	{
+		return std::atomic_ref<T>{ value };
+	}
+}
 
 //--------------------------------------------------------------------------------------------------
 
 void MCTS::Search(Board& board, int iterations, float explorationConstant)
 {
-    Node root{ board, Player::O, nullptr };
+	// Reaproveita a memória da arena entre buscas da mesma thread
+	thread_local Tree tree;
+	tree.Clear();
+	tree.Search(board, iterations, explorationConstant);
+}
+
+//--------------------------------------------------------------------------------------------------
+
+void MCTS::RootParallelSearch(Board& board, int iterations, float explorationConstant, int threads)
+{
+	// Árvores independentes, uma por thread, combinadas pelas estatísticas da raiz
+	std::vector<std::unique_ptr<Tree>> trees;
+	std::vector<std::thread> workers;
+
+	for (int i{}; i < threads; ++i)
+		trees.push_back(std::make_unique<Tree>());
+
+	for (int i{}; i < threads; ++i)
+	{
+		const int share{ iterations / threads + (i < iterations % threads) };
+
+		workers.emplace_back([&board, &tree = *trees[i], share, explorationConstant] {
+			Board copy{ board };
+			tree.Search(copy, share, explorationConstant);
+		});
+	}
+
+	for (auto& worker : workers)
+		worker.join();
+
+	// Soma visitas e scores de cada jogada da raiz
+	std::array<Statistics, Board::Size> total{};
+	std::vector<Statistics> statistics;
+
+	for (const auto& tree : trees)
+	{
+		tree->GetRootStatistics(statistics);
+
+		for (const auto& [move, visits, score] : statistics)
+		{
+			total[move].visits += visits;
+			total[move].score += score;
+		}
+	}
+
+	// Escolhe a jogada com a melhor média da perspectiva do jogador da vez
+	const Player player{ board.Turn() };
+	int bestMove{ -1 };
+	float bestValue{ -std::numeric_limits<float>::infinity() };
+
+	for (int move{}; move < Board::Size; ++move)
+	{
+		if (total[move].visits == 0)
+			continue;
+
+		if (const float value{ float(player) * total[move].score / total[move].visits }; value > bestValue)
+		{
+			bestValue = value;
+			bestMove = move;
+		}
+	}
+
+	if (bestMove >= 0)
+		board.MakeMove(bestMove);
+}
+
+//--------------------------------------------------------------------------------------------------
+
+MCTS::Tree::~Tree()
+{
+	Cancel();
+}
+
+//--------------------------------------------------------------------------------------------------
+
+void MCTS::Tree::Search(Board& board, int iterations, float explorationConstant, int threads)
+{
+	Execute(board, iterations, Time::max(), explorationConstant, threads);
+}
+
+//--------------------------------------------------------------------------------------------------
+
+void MCTS::Tree::SearchFor(Board& board, float milliseconds, float explorationConstant, int threads)
+{
+	const Time deadline{ high_resolution_clock::now() + duration_cast<Time::duration>(duration<float, std::milli>(milliseconds)) };
+	Execute(board, std::numeric_limits<int>::max(), deadline, explorationConstant, threads);
+}
+
+//--------------------------------------------------------------------------------------------------
+
+void MCTS::Tree::SearchAsync(const Board& board, float milliseconds, float explorationConstant, int threads)
+{
+	Cancel();
+
+	// A busca roda em outra thread sobre uma cópia do tabuleiro
+	pending = std::async(std::launch::async, [this, board, milliseconds, explorationConstant, threads] {
+		Board result{ board };
+		SearchFor(result, milliseconds, explorationConstant, threads);
+		return result;
+	});
+}
+
+//--------------------------------------------------------------------------------------------------
+
+void MCTS::Tree::SearchAsync(const Board& board, int iterations, float explorationConstant, int threads)
+{
+	Cancel();
+
+	// Orçamento de iterações: com uma thread e semente fixa, a jogada é reproduzível
+	pending = std::async(std::launch::async, [this, board, iterations, explorationConstant, threads] {
+		Board result{ board };
+		Search(result, iterations, explorationConstant, threads);
+		return result;
+	});
+}
+
+//--------------------------------------------------------------------------------------------------
+
+bool MCTS::Tree::Poll(Board& board)
+{
+	// Retorna a jogada apenas quando a busca em segundo plano termina
+	if (!pending.valid() || pending.wait_for(seconds(0)) != std::future_status::ready)
+		return false;
+
+	board = pending.get();
+	return true;
+}
+
+//--------------------------------------------------------------------------------------------------
+
+bool MCTS::Tree::IsSearching() const
+{
+	return pending.valid();
+}
+
+//--------------------------------------------------------------------------------------------------
+
+void MCTS::Tree::Cancel()
+{
+	if (!pending.valid())
+		return;
+
+	// Interrompe a busca e descarta o resultado
+	stop = true;
+	pending.wait();
+	pending = {};
+	stop = false;
+}
+
+//--------------------------------------------------------------------------------------------------
+
+void MCTS::Tree::Execute(Board& board, int iterations, Time deadline, float explorationConstant, int threads)
+{
+	// Reaproveita a subárvore da posição atual ou recomeça do zero
+	if (!Reroot(board))
+	{
+		Clear();
+		(*nodes)[nodes->Allocate(1)] = Node{ board, Node::Null, -1 };
+	}
+
+	// As jogadas dos nós estão na orientação do tabuleiro real
+	root = board;
+
+	// Uma raiz já provada (empate decidido) encerra a busca de imediato, mas ainda precisa das jogadas
+	if (!(*nodes)[0].IsTerminal())
+		Expand(0, root);
+
+	completed = 0;
+
+	if (threads <= 1)
+		Run(iterations, deadline, explorationConstant, random);
+	else
+	{
+		// Todas as threads descem pela mesma árvore, cada uma com seu próprio gerador
+		std::vector<std::thread> workers;
+		const uint64_t seed{ random() };
+
+		for (int i{ 1 }; i < threads; ++i)
+		{
+			workers.emplace_back([this, i, seed, share{ iterations / threads }, deadline, explorationConstant] {
+				Random generator{ seed + uint64_t(i) };
+				Run(share, deadline, explorationConstant, generator);
+			});
+		}
+
+		Run(iterations - iterations / threads * (threads - 1), deadline, explorationConstant, random);
+
+		for (auto& worker : workers)
+			worker.join();
+	}
+
+	if (const uint32_t selected{ Best(0, random) }; selected != 0)
+		board.MakeMove((*nodes)[selected].move);
+}
+
+//--------------------------------------------------------------------------------------------------
+
+void MCTS::Tree::Clear()
+{
+	// Os nós não têm destrutor, então a liberação é O(1)
+	nodes->Clear();
+}
+
+//--------------------------------------------------------------------------------------------------
+
+void MCTS::Tree::Seed(uint32_t seed)
+{
+	// Com uma thread, a mesma semente reproduz a mesma busca
+	random.Seed(seed);
+}
+
+//--------------------------------------------------------------------------------------------------
+
+void MCTS::Tree::SetRollouts(int count)
+{
+	rollouts = std::max(1, count);
+}
+
+//--------------------------------------------------------------------------------------------------
+
+void MCTS::Tree::SetRave(float equivalence)
+{
+	this->equivalence = std::max(0.f, equivalence);
+}
+
+//--------------------------------------------------------------------------------------------------
+
+uint32_t MCTS::Tree::Size() const
+{
+	return nodes->Size();
+}
+
+//--------------------------------------------------------------------------------------------------
+
+int MCTS::Tree::Iterations() const
+{
+	return completed.load(std::memory_order_relaxed);
+}
+
+//--------------------------------------------------------------------------------------------------
+
+void MCTS::Tree::GetRootStatistics(std::vector<Statistics>& statistics) const
+{
+	statistics.clear();
+
+	if (nodes->Empty() || !(*nodes)[0].IsExpanded())
+		return;
+
+	const Node& root{ (*nodes)[0] };
+
+	for (uint32_t child{ root.firstChild }; child < root.firstChild + root.childCount; ++child)
+	{
+		const Node& node{ (*nodes)[child] };
+		statistics.push_back({ node.move, node.visits, node.score });
+	}
+}
+
+//--------------------------------------------------------------------------------------------------
+
+void MCTS::Tree::Run(int iterations, Time deadline, float explorationConstant, Random& random)
+{
+	Arena<Node>& nodes{ *this->nodes };
+	int i{};
+
+	for (; i < iterations; ++i)
+	{
+		// Consulta o relógio periodicamente para respeitar o orçamento de tempo
+		if (i % CheckInterval == 0 && (stop.load(std::memory_order_relaxed) || (deadline != Time::max() && high_resolution_clock::now() >= deadline)))
+			break;
+
+		// Raiz resolvida: mais iterações não mudariam a jogada
+		if (Atomic(nodes[0].proof).load(std::memory_order_relaxed) != Node::Unknown)
+			break;
+
+		uint32_t index{};
+		Board board{ root };
+		AddVirtualLoss(index);
+
+		while (!nodes[index].IsTerminal())
+		{
+			const uint32_t next{ Select(index, board, explorationConstant, random) };
+
+			// Nó ainda sem filhos (outra thread o expande ou a arena encheu): simula a partir dele
+			if (next == index)
+				break;
+
+			const bool unvisited{ Atomic(nodes[next].visits).load(std::memory_order_relaxed) == 0 };
+
+			AddVirtualLoss(next);
+			index = next;
+			board.MakeMove(nodes[index].move);
+
+			if (unvisited)
+				break;
+		}
+
+		// Com RAVE, o tabuleiro final indica as jogadas feitas por cada jogador
+		Board final;
+		Board* played{ equivalence > 0 ? &final : nullptr };
+
+		float score{ Node::Rollout(board, random, rollouts, played) };
+		Backpropagate(index, score, played);
+	}
+
+	completed.fetch_add(i, std::memory_order_relaxed);
+}
+
+//--------------------------------------------------------------------------------------------------
+
+uint32_t MCTS::Tree::Select(uint32_t index, const Board& board, float explorationConstant, Random& random)
+{
+	Arena<Node>& nodes{ *this->nodes };
+	Node& node{ nodes[index] };
+
+	if (node.IsTerminal())
+		return index;
+
+	uint32_t first{ Atomic(node.firstChild).load(std::memory_order_acquire) };
+
+	if (first == Node::Null)
+	{
+		Expand(index, board);
+		first = Atomic(node.firstChild).load(std::memory_order_acquire);
+	}
+
+	// Expansão em andamento em outra thread ou sem memória para os filhos
+	if (first >= Node::Busy)
+		return index;
+
+	// Caso haja filhos não explorados, retorna o próximo deles
+	if (Atomic(node.explored).load(std::memory_order_relaxed) < node.childCount)
+	{
+		if (const uint8_t explored{ Atomic(node.explored).fetch_add(1, std::memory_order_relaxed) }; explored < node.childCount)
+			return first + explored;
+	}
+
+	float bestValue{ -std::numeric_limits<float>::infinity() };
+	uint32_t best{ index };
+	uint32_t ties{};
+
+	const float nodeVisits{ float(Atomic(node.visits).load(std::memory_order_relaxed)) };
+	const float logVisits{ std::logf(nodeVisits) };
+
+	// Peso das estatísticas AMAF: dominam no início e somem conforme o nó é visitado
+	const float beta{ equivalence > 0 ? std::sqrtf(equivalence / (3 * nodeVisits + equivalence)) : 0.f };
+
+	// Seleciona os nós mais promissores usando UCB1
+	for (uint32_t adj{ first }, end{ first + node.childCount }; adj < end; ++adj)
+	{
+		Node& child{ nodes[adj] };
+
+		// Filho reservado por outra thread que ainda não aplicou a perda virtual
+		const int visits{ Atomic(child.visits).load(std::memory_order_relaxed) };
+		if (visits == 0)
+			continue;
+
+		// Subárvores resolvidas não têm mais o que aprender
+		if (Atomic(child.proof).load(std::memory_order_relaxed) != Node::Unknown)
+			continue;
+
+		// Calcula o score da perspectiva do jogador atual
+		const float score{ Atomic(child.score).load(std::memory_order_relaxed) };
+		float adjScore{ node.NextPlayer() == Player::O ? score : -score };
+
+		// Calcula o UCB1, misturando a média AMAF quando o RAVE está ligado
+		float exploitation{ adjScore / visits };
+
+		if (const int amafVisits{ Atomic(child.amafVisits).load(std::memory_order_relaxed) }; beta > 0 && amafVisits > 0)
+		{
+			const float amafScore{ Atomic(child.amafScore).load(std::memory_order_relaxed) };
+			const float amaf{ (node.NextPlayer() == Player::O ? amafScore : -amafScore) / amafVisits };
+			exploitation = (1 - beta) * exploitation + beta * amaf;
+		}
+
+		const float exploration{ explorationConstant * std::sqrtf(logVisits / visits) };
+		const float ucbValue{ exploitation + exploration };
+
+		// Se o valor encontrado for melhor que o anterior, recomeça o sorteio
+		if (ucbValue > bestValue)
+		{
+			ties = 0;
+			bestValue = ucbValue;
+		}
+
+		// Empates são sorteados sem lista: o k-ésimo substitui o escolhido com chance 1/k
+		if (std::fabs(ucbValue - bestValue) < 1e-6f && random.Below(++ties) == 0)
+			best = adj;
+	}
+
+	// Retorna um dos sucessores mais promissores
+	return best;
+}
+
+//--------------------------------------------------------------------------------------------------
+
+uint32_t MCTS::Tree::Best(uint32_t index, Random& random) const
+{
+	const Arena<Node>& nodes{ *this->nodes };
+	const Node& node{ nodes[index] };
+
+	if (node.IsTerminal() || !node.IsExpanded())
+		return index;
+
+	float bestValue{ -std::numeric_limits<float>::infinity() };
+	uint32_t best{ index };
+	uint32_t ties{};
+
+	// Melhor média da perspectiva do jogador da vez; valores provados substituem as médias
+	for (uint32_t adj{ node.firstChild }, end{ node.firstChild + node.childCount }; adj < end; ++adj)
+	{
+		const Node& child{ nodes[adj] };
+		float value;
+
+		switch (child.proof)
+		{
+		case Node::Loss:
+			return adj;
+
+		case Node::Win:
+			value = -2.f;  // Só quando todas as jogadas perdem
+			break;
+
+		case Node::Draw:
+			value = 0.f;
+			break;
+
+		default:
+			if (child.visits == 0)
+				continue;
+
+			value = (node.NextPlayer() == Player::O ? child.score : -child.score) / child.visits;
+			break;
+		}
+
+		if (value > bestValue)
+		{
+			ties = 0;
+			bestValue = value;
+		}
+
+		if (std::fabs(value - bestValue) < 1e-6f && random.Below(++ties) == 0)
+			best = adj;
+	}
+
+	return best;
+}
+
+//--------------------------------------------------------------------------------------------------
+
+bool MCTS::Tree::Expand(uint32_t index, const Board& position)
+{
+	Arena<Node>& nodes{ *this->nodes };
+	Node& node{ nodes[index] };
+
+	// Apenas uma thread expande o nó; as demais seguem sem esperar
+	uint32_t expected{ Node::Null };
+	if (!Atomic(node.firstChild).compare_exchange_strong(expected, Node::Busy, std::memory_order_acquire))
+		return false;
+
+	Board board{ position };
+
+	// Apenas uma jogada por classe de simetria
+	const Board::Mask moves{ board.DistinctMoves() };
+	const uint32_t count{ uint32_t(std::popcount(moves)) };
+
+	// Os filhos são alocados de uma vez, contíguos na arena
+	const uint32_t first{ nodes.Allocate(count) };
+
+	// Arena cheia: o nó continua folha e as simulações partem dele
+	if (first == Arena<Node>::Full)
+	{
+		Atomic(node.firstChild).store(Node::Null, std::memory_order_release);
+		return false;
+	}
+
+	uint32_t child{ first };
+
+	for (Board::Mask remaining{ moves }; remaining; remaining &= remaining - 1)
+	{
+		const int move{ std::countr_zero(remaining) };
+
+		board.MakeMove(move);
+		nodes[child++] = Node{ board, index, move };
+		board.UnmakeMove();
+	}
+
+	// Publica os filhos para as demais threads
+	node.childCount = uint8_t(count);
+	Atomic(node.firstChild).store(first, std::memory_order_release);
+
+	return true;
+}
+
+//--------------------------------------------------------------------------------------------------
+
+void MCTS::Tree::AddVirtualLoss(uint32_t index)
+{
+	// Conta a visita antecipadamente como derrota de quem jogou para chegar ao nó
+	Node& node{ (*nodes)[index] };
+	Atomic(node.visits).fetch_add(1, std::memory_order_relaxed);
+	Atomic(node.score).fetch_add(VirtualLoss * float(node.NextPlayer()), std::memory_order_relaxed);
+}
+
+//--------------------------------------------------------------------------------------------------
+
+void MCTS::Tree::Backpropagate(uint32_t index, float score, const Board* final)
+{
+	Arena<Node>& nodes{ *this->nodes };
+
+	// Prova a propagar: o nó simulado já resolvido (terminal) ou com todos os filhos resolvidos
+	bool proving{ Atomic(nodes[index].proof).load(std::memory_order_relaxed) != Node::Unknown || Prove(index) };
+
+	// As visitas já foram contadas na descida; desfaz a perda virtual
+	while (index != Node::Null)
+	{
+		Node& node{ nodes[index] };
+		Atomic(node.score).fetch_add(score - VirtualLoss * float(node.NextPlayer()), std::memory_order_relaxed);
+
+		// AMAF: atualiza os filhos cuja jogada o jogador da vez fez em qualquer momento depois deste nó
+		const uint32_t first{ Atomic(node.firstChild).load(std::memory_order_acquire) };
+
+		if (final && first < Node::Busy)
+		{
+			const Board::Mask played{ final->Occupied(node.NextPlayer()) };
+
+			for (uint32_t child{ first }; child < first + node.childCount; ++child)
+			{
+				if (played >> nodes[child].move & 1)
+				{
+					Atomic(nodes[child].amafVisits).fetch_add(1, std::memory_order_relaxed);
+					Atomic(nodes[child].amafScore).fetch_add(score, std::memory_order_relaxed);
+				}
+			}
+		}
+
+		index = node.parent;
+
+		// Cada prova nova pode resolver o pai; a primeira posição em aberto interrompe a cadeia
+		if (proving && index != Node::Null)
+			proving = Prove(index);
+	}
+}
+
+//--------------------------------------------------------------------------------------------------
+
+bool MCTS::Tree::Prove(uint32_t index)
+{
+	Arena<Node>& nodes{ *this->nodes };
+	Node& node{ nodes[index] };
+
+	const uint32_t first{ Atomic(node.firstChild).load(std::memory_order_acquire) };
+
+	if (first >= Node::Busy || Atomic(node.proof).load(std::memory_order_relaxed) != Node::Unknown)
+		return false;
+
+	// Um filho perdido para o adversário é vitória; todos resolvidos sem isso, empate ou derrota
+	bool draw{};
+
+	for (uint32_t child{ first }; child < first + node.childCount; ++child)
+	{
+		switch (Atomic(nodes[child].proof).load(std::memory_order_relaxed))
+		{
+		case Node::Loss:
+			Atomic(node.proof).store(Node::Win, std::memory_order_relaxed);
+			return true;
+
+		case Node::Draw:
+			draw = true;
+			break;
+
+		case Node::Unknown:
+			return false;
+
+		default:
+			break;
+		}
+	}
+
+	Atomic(node.proof).store(draw ? Node::Draw : Node::Loss, std::memory_order_relaxed);
+	return true;
+}
+
+//--------------------------------------------------------------------------------------------------
+
+bool MCTS::Tree::Reroot(const Board& board)
+{
+	int symmetry;
+	const uint32_t found{ Find(board, symmetry) };
+
+	if (found == Node::Null)
+		return false;
+
+	if (found == 0 && symmetry == 0)
+		return true;
+
+	Arena<Node>& from{ *nodes };
+	Arena<Node>& to{ *spare };
+
+	// Copia a subárvore alcançável em largura, mantendo os filhos contíguos
+	to.Clear();
+	to[to.Allocate(1)] = from[found];
+	to[0].parent = Node::Null;
+
+	std::vector<uint32_t> queue{ 0 };
+
+	for (size_t i{}; i < queue.size(); ++i)
+	{
+		const uint32_t index{ queue[i] };
+		Node& node{ to[index] };
+
+		// Leva as jogadas para o referencial do tabuleiro real
+		if (symmetry && node.move >= 0)
+			node.move = int8_t(Board::TransformSquare(node.move, symmetry));
+
+		if (!node.IsExpanded())
+			continue;
+
+		const uint32_t first{ to.Allocate(node.childCount) };
+
+		for (uint32_t child{}; child < node.childCount; ++child)
+		{
+			to[first + child] = from[node.firstChild + child];
+			to[first + child].parent = index;
+			queue.push_back(first + child);
+		}
+
+		node.firstChild = first;
+	}
+
+	// Os irmãos inalcançáveis são descartados junto com a arena antiga
+	std::swap(nodes, spare);
+	from.Clear();
+
+	return true;
+}
+
+//--------------------------------------------------------------------------------------------------
+
+uint32_t MCTS::Tree::Find(const Board& board, int& symmetry) const
+{
+	const Arena<Node>& nodes{ *this->nodes };
+
+	if (nodes.Empty())
+		return Node::Null;
+
+	// Profundidade da posição procurada em relação à raiz
+	auto stones{ [](const Board& board) { return Board::Size - std::popcount(board.Available()); } };
+	const int depth{ stones(board) - stones(root) };
+
+	if (depth < 0)
+		return Node::Null;
+
+	// Percorre os níveis expandidos até a profundidade da posição, refazendo os tabuleiros
+	std::vector<std::pair<uint32_t, Board>> level{ { 0, root } }, next;
+
+	for (int i{}; i < depth; ++i)
+	{
+		next.clear();
+
+		for (const auto& [index, position] : level)
+		{
+			const Node& node{ nodes[index] };
 
-    for (int i{}; i < iterations; ++i)
-    {
-        Node* node{ &root };
+			for (uint32_t child{}; node.IsExpanded() && child < node.childCount; ++child)
+			{
+				Board board{ position };
+				board.MakeMove(nodes[node.firstChild + child].move);
+				next.emplace_back(node.firstChild + child, board);
+			}
+		}
 
-        while (!node->IsTerminal())
-        {
-            node = node->Select(explorationConstant);
-            if (node->Visits() == 0)
-                break;
-        }
+		std::swap(level, next);
+	}
 
-        float score{ node->Rollout() };
-        node->Backpropagate(score);
-    }
+	// Procura uma posição equivalente (a árvore guarda uma jogada por classe de simetria)
+	for (const auto& [index, position] : level)
+	{
+		for (symmetry = 0; symmetry < Board::Symmetries; ++symmetry)
+		{
+			if (position.Turn() == board.Turn() && position.Transformed(symmetry) == board)
+				return index;
+		}
+	}
 
-    Node* selected{ root.Select(0.f) };
-    selected->GetBoard(board);
+	return Node::Null;
 }
 
 //--------------------------------------------------------------------------------------------------
@@ -3,13 +3,74 @@
 
 //--------------------------------------------------------------------------------------------------
 
-class Board;
+#include "Node.h"
+#include "Arena.h"
+#include "Clock.h"
+#include <vector>
+#include <future>
+#include <random>
 
 //--------------------------------------------------------------------------------------------------
 
 namespace MCTS
 {
+	struct Statistics
+	{
+		int   move;
+		int   visits;
+		float score;
+	};
+
+	class Tree
+	{
+	public:
+		~Tree();
+
+		void Search(Board& board, int iterations, float explorationConstant, int threads = 1);
+		void SearchFor(Board& board, float milliseconds, float explorationConstant, int threads = 1);
+		void SearchAsync(const Board& board, float milliseconds, float explorationConstant, int threads = 1);
+		void SearchAsync(const Board& board, int iterations, float explorationConstant, int threads = 1);
+		bool Poll(Board& board);
+		bool IsSearching() const;
+		void Cancel();
+		void Clear();
+		void Seed(uint32_t seed);
+		void SetRollouts(int count);
+		void SetRave(float equivalence);
+		uint32_t Size() const;
+		int Iterations() const;
+		void GetRootStatistics(std::vector<Statistics>& statistics) const;
+
+	private:
+		static constexpr float VirtualLoss{ 1.f };
+		static constexpr int   CheckInterval{ 64 }; // Iterações entre consultas ao relógio
+
+		void Execute(Board& board, int iterations, Time deadline, float explorationConstant, int threads);
+		void Run(int iterations, Time deadline, float explorationConstant, Random& random);
+		uint32_t Select(uint32_t index, const Board& board, float explorationConstant, Random& random);
+		uint32_t Best(uint32_t index, Random& random) const;
+		bool Expand(uint32_t index, const Board& board);
+		void AddVirtualLoss(uint32_t index);
+		void Backpropagate(uint32_t index, float score, const Board* final);
+		bool Prove(uint32_t index);
+		bool Reroot(const Board& board);
+		uint32_t Find(const Board& board, int& symmetry) const;
+
+		Arena<Node>  arenas[2];
+		Arena<Node>* nodes{ &arenas[0] }; // Arena: a raiz ocupa o índice 0
+		Arena<Node>* spare{ &arenas[1] }; // Arena auxiliar usada ao reenraizar a árvore
+		Board        root;                // Posição da raiz; as demais são refeitas a partir dela
+		Random       random{ std::random_device{}() };
+		int          rollouts{ 1 };  // Simulações por folha (em lote quando maior que 1)
+		float        equivalence{}; // Parâmetro k do RAVE: beta = sqrt(k / (3n + k)); 0 desliga
+
+		std::future<Board> pending;     // Busca em segundo plano
+		std::atomic<bool>  stop{};      // Pedido de interrupção da busca
+		std::atomic<int>   completed{}; // Iterações feitas pela última busca
+	};
+
 	void Search(Board& board, int iterations, float explorationConstant);
+	void RootParallelSearch(Board& board, int iterations, float explorationConstant, int threads);
 }
 
 //--------------------------------------------------------------------------------------------------
@@ -1,13 +1,24 @@
 #include "Engine.h"
 #include "TicTacToe.h"
+#include "Settings.h"
+#include <iostream>
 
 //--------------------------------------------------------------------------------------------------
 
 int main(int argc, char** argv)
 {
-    Engine::window.Size(600, 600);
+    // Configuração da IA e da janela pela linha de comando (ou por arquivo, com --config)
+    Settings settings;
+
+    if (!settings.Parse(argc, argv))
+    {
+        std::cerr << "Uso: " << argv[0] << ' ' << Settings::Usage() << '\n';
+        return 1;
+    }
+
+    Engine::window.Size(settings.size, settings.size);
     Engine::window.Title("Tic Tac Toe");
-    Engine::Run(new TicTacToe);
+    Engine::Run(new TicTacToe{ settings });
 
     return 0;
 }
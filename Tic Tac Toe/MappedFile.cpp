@@ -0,0 +1,87 @@
+#include "MappedFile.h"
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+//--------------------------------------------------------------------------------------------------
+
+MappedFile::~MappedFile()
+{
+    Close();
+}
+
+//--------------------------------------------------------------------------------------------------
+
+bool MappedFile::Open(const char* path)
+{
+    Close();
+
+    // Mapeia o arquivo inteiro; os descritores podem ser fechados logo em seguida
+#ifdef _WIN32
+    const HANDLE file{ CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr) };
+
+    if (file == INVALID_HANDLE_VALUE)
+        return false;
+
+    LARGE_INTEGER size{};
+
+    if (GetFileSizeEx(file, &size) && size.QuadPart > 0)
+    {
+        if (const HANDLE mapping{ CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr) })
+        {
+            view = static_cast<const std::byte*>(MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0));
+            CloseHandle(mapping);
+        }
+    }
+
+    CloseHandle(file);
+    length = view ? size_t(size.QuadPart) : 0;
+#else
+    const int file{ open(path, O_RDONLY) };
+
+    if (file < 0)
+        return false;
+
+    struct stat status{};
+
+    if (fstat(file, &status) == 0 && status.st_size > 0)
+    {
+        if (void* pages{ mmap(nullptr, size_t(status.st_size), PROT_READ, MAP_PRIVATE, file, 0) }; pages != MAP_FAILED)
+        {
+            view = static_cast<const std::byte*>(pages);
+            length = size_t(status.st_size);
+        }
+    }
+
+    close(file);
+#endif
+
+    return view != nullptr;
+}
+
+//--------------------------------------------------------------------------------------------------
+
+void MappedFile::Close()
+{
+    if (view)
+    {
+#ifdef _WIN32
+        UnmapViewOfFile(view);
+#else
+        munmap(const_cast<std::byte*>(view), length);
+#endif
+    }
+
+    view = nullptr;
+    length = 0;
+}
+
+//--------------------------------------------------------------------------------------------------
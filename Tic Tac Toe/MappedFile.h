@@ -0,0 +1,63 @@
+#ifndef QUANTVERSO_MAPPEDFILE_H
+#define QUANTVERSO_MAPPEDFILE_H
+
+//--------------------------------------------------------------------------------------------------
+
+#include <cstddef>
+
+//--------------------------------------------------------------------------------------------------
+
+////////////////////////////////////////////////////////////
+/// class MappedFile
+/// \brief Arquivo mapeado em memória somente para leitura.
+///
+/// As páginas são carregadas pelo sistema sob demanda e
+/// compartilhadas entre processos que mapeiam o mesmo
+/// arquivo. O mapeamento dura até Close() ou a destruição.
+///
+////////////////////////////////////////////////////////////
+class MappedFile
+{
+public:
+    MappedFile() = default;
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+    ~MappedFile();
+
+    // Falha se o arquivo não existir ou estiver vazio
+    bool Open(const char* path);
+    void Close();
+
+    bool IsOpen() const;
+    const std::byte* Data() const;
+    size_t Size() const;
+
+private:
+    const std::byte* view{};
+    size_t           length{};
+};
+
+//--------------------------------------------------------------------------------------------------
+
+inline bool MappedFile::IsOpen() const
+{
+    return view != nullptr;
+}
+
+//--------------------------------------------------------------------------------------------------
+
+inline const std::byte* MappedFile::Data() const
+{
+    return view;
+}
+
+//--------------------------------------------------------------------------------------------------
+
+inline size_t MappedFile::Size() const
+{
+    return length;
+}
+
+//--------------------------------------------------------------------------------------------------
+
+#endif
@@ -1,46 +1,97 @@
 #include "Minimax.h"
+#include "GameTable.h"
 #include <limits>
+#include <iostream>
 
 //--------------------------------------------------------------------------------------------------
 
 void Minimax::Search(Board& board)
 {
-    auto result{ Value(board, 0, true) };
-    if (result.second)
-        *result.second = Player::O;
+#ifdef _DEBUG
+    // Confere a tabela gerada em tempo de compilação uma única vez
+    [[maybe_unused]] static const bool validated{ Validate() };
+#endif
+
+    // Consulta a jogada ótima na tabela pré-calculada
+    const Player player{ board.Turn() };
+
+    if (const auto entry{ GameTable::Lookup(board, player) }; entry.move >= 0)
+        board.MakeMove(entry.move);
 }
 
 //--------------------------------------------------------------------------------------------------
 
-std::pair<int, Player*> Minimax::Value(Board& board, int depth, bool isMaximizing)
+bool Minimax::Validate()
 {
-    // Se h vencedor (estado terminal), retorna utilidade
+    int mismatches{};
+
+    for (Board::Mask o{}; o <= Board::Full; ++o)
+    {
+        for (Board::Mask x{}; x <= Board::Full; ++x)
+        {
+            if (o & x)
+                continue;
+
+            Board board;
+            for (int square{}; square < Board::Size; ++square)
+                board.Set(square, o & (1 << square) ? Player::O : x & (1 << square) ? Player::X : Player::None);
+
+            // Jogador da vez (X começa)
+            const Player player{ std::popcount(x) == std::popcount(o) ? Player::X : Player::O };
+            const auto entry{ GameTable::Lookup(board, player) };
+
+            if (!entry.reachable)
+                continue;
+
+            // Compara com a busca recursiva (utilidade da perspectiva de O)
+            auto [value, move] { Value(board, 0, player == Player::O) };
+
+            if (player == Player::X)
+                value = -value;
+
+            if (value != entry.value || move != entry.move)
+                mismatches++;
+        }
+    }
+
+    if (mismatches)
+        std::cerr << "Tabela de jogo divergente do Minimax em " << mismatches << " posicoes!\n";
+
+    return mismatches == 0;
+}
+
+//--------------------------------------------------------------------------------------------------
+
+std::pair<int, int> Minimax::Value(Board& board, int depth, bool isMaximizing)
+{
+    // Se há vencedor (estado terminal), retorna utilidade
     if (Player winner{ board.CheckWinner() }; winner == Player::O)
-        return { 10 - depth, nullptr };
+        return { 10 - depth, -1 };
     else if (winner == Player::X)
-        return { depth - 10, nullptr };
+        return { depth - 10, -1 };
 
-    // Obtm movimentos vlidos
-    std::vector<Player*> moves;
-    board.GetAvailableMoves(moves);
+    // Obtém movimentos válidos
+    Board::Mask moves{ board.Available() };
 
-    // Se h empate (estado terminal), retorna utilidade
-    if (moves.empty())
-        return { 0, nullptr };
+    // Se há empate (estado terminal, ou decidido abaixo da raiz), retorna utilidade
+    if (moves == 0 || (depth > 0 && board.IsDeadDraw()))
+        return { 0, -1 };
 
     int bestValue{ isMaximizing ? std::numeric_limits<int>::min() : std::numeric_limits<int>::max() };
-    Player* bestMove;
+    int bestMove{ -1 };
 
-    for (auto& move : moves)
+    for (; moves; moves &= moves - 1)
     {
-        // Faz a jogada
-        *move = isMaximizing ? Player::O : Player::X;
+        const int move{ std::countr_zero(moves) };
+
+        // Faz a jogada (O maximiza e é o jogador da vez quando isMaximizing)
+        board.MakeMove(move);
 
         // Calcula valor recursivamente com a profundidade aumentada
         auto [value, _] { Value(board, depth + 1, !isMaximizing) };
 
-        // Restaura o tabuleiro
-        *move = Player::None;
+        // Desfaz a jogada
+        board.UnmakeMove();
 
         // Atualiza melhor valor e movimento
         if ((isMaximizing && value > bestValue) || (!isMaximizing && value < bestValue))
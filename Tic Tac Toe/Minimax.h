@@ -3,7 +3,11 @@
 
 //--------------------------------------------------------------------------------------------------
 
-#include "TicTacToe.h"
+#include "Board.h"
+#include "Grid.h"
+#include "Clock.h"
+#include <algorithm>
+#include <limits>
 
 //--------------------------------------------------------------------------------------------------
 
@@ -12,10 +16,289 @@ class Minimax
 public:
     static void Search(Board& board);
 
-private:    
-    static std::pair<int, Player*> Value(Board& board, int depth, bool isMaximizing);
+    // Busca limitada em profundidade para tabuleiros m,n,k: retorna { valor, jogada }
+    template <int M, int N, int K>
+    static std::pair<int, int> Search(Grid<M, N, K>& grid, Player player, int depth);
+
+    struct Result
+    {
+        int      value; // Utilidade para o jogador da vez na última profundidade completa
+        int      move;  // Melhor jogada dessa profundidade (-1 em posições terminais)
+        int      depth; // Última profundidade completa (0 se nenhuma terminou no prazo)
+        uint64_t nodes; // Nós visitados em todas as iterações
+    };
+
+    // Avaliação padrão: janelas de K casas ainda abertas para cada jogador
+    struct Windows
+    {
+        template <int M, int N, int K>
+        int operator()(const Grid<M, N, K>& grid, Player player) const;
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Aprofundamento iterativo com prazo para m,n,k.
+    ///
+    /// Cada iteração é um negamax alfa-beta de profundidade
+    /// fixa, com janela de aspiração em torno do valor da
+    /// anterior e a variação principal anterior tentada
+    /// primeiro. No horizonte vale `evaluate(grid, jogador da
+    /// vez)`. Esgotado o prazo, a iteração em curso é
+    /// descartada e vale a última profundidade completa.
+    ///
+    ////////////////////////////////////////////////////////////
+    template <int M, int N, int K, typename Evaluate = Windows>
+    static Result SearchFor(Grid<M, N, K>& grid, Player player, float milliseconds, Evaluate evaluate = {});
+
+private:
+    static constexpr int Win{ 1000 };
+    static constexpr int MaxPly{ 64 };
+    static constexpr int Aspiration{ 25 };    // Meia largura inicial da janela de aspiração
+    static constexpr int CheckInterval{ 64 }; // Nós entre consultas ao relógio
+
+    // Estado de uma busca com prazo, compartilhado por todas as chamadas recursivas
+    template <typename Evaluate>
+    struct Context
+    {
+        Evaluate                                        evaluate;
+        Time                                            deadline;
+        uint64_t                                        nodes{};
+        bool                                            stop{};
+        int                                             length{};   // Tamanho da variação principal anterior
+        std::array<int16_t, MaxPly>                     previous{}; // Variação principal da iteração anterior
+        std::array<std::array<int16_t, MaxPly>, MaxPly> lines{};    // Variação principal a partir de cada ply
+        std::array<int, MaxPly>                         ends{};     // Fim de cada variação em `lines`
+    };
+
+    static bool Validate();
+    static std::pair<int, int> Value(Board& board, int depth, bool isMaximizing);
+
+    template <int M, int N, int K>
+    static int Negamax(Grid<M, N, K>& grid, Player player, int depth, int ply, int alpha, int beta, int& move);
+
+    template <int M, int N, int K, typename Evaluate>
+    static int Negamax(Grid<M, N, K>& grid, Player player, int depth, int ply, int alpha, int beta, bool principal, Context<Evaluate>& context);
 };
 
 //--------------------------------------------------------------------------------------------------
 
+template <int M, int N, int K>
+inline std::pair<int, int> Minimax::Search(Grid<M, N, K>& grid, Player player, int depth)
+{
+    int move{ -1 };
+    const int value{ Negamax(grid, player, depth, 0, -Win - 1, Win + 1, move) };
+
+    return { value, move };
+}
+
+//--------------------------------------------------------------------------------------------------
+
+template <int M, int N, int K>
+inline int Minimax::Negamax(Grid<M, N, K>& grid, Player player, int depth, int ply, int alpha, int beta, int& move)
+{
+    // A vitória do adversário já foi detectada pela última jogada
+    if (grid.Winner() != Player::None)
+        return ply - Win;
+
+    // Empate ou horizonte da busca
+    if (grid.IsTerminal() || depth == 0)
+        return 0;
+
+    int bestValue{ std::numeric_limits<int>::min() };
+    int child;
+
+    grid.Available().ForEach([&](int square) {
+        if (alpha >= beta)
+            return;
+
+        grid.Play(square, player);
+        const int value{ -Negamax(grid, Player(-player), depth - 1, ply + 1, -beta, -alpha, child) };
+        grid.Undo(square);
+
+        if (value > bestValue)
+        {
+            bestValue = value;
+            move = square;
+        }
+
+        alpha = std::max(alpha, value);
+    });
+
+    return bestValue;
+}
+
+//--------------------------------------------------------------------------------------------------
+
+template <int M, int N, int K, typename Evaluate>
+inline Minimax::Result Minimax::SearchFor(Grid<M, N, K>& grid, Player player, float milliseconds, Evaluate evaluate)
+{
+    using Game = Grid<M, N, K>;
+
+    const Time deadline{ high_resolution_clock::now() + duration_cast<Time::duration>(duration<float, std::milli>(milliseconds)) };
+    Context<Evaluate> context{ evaluate, deadline };
+
+    Result result{ 0, -1, 0, 0 };
+
+    if (grid.Winner() != Player::None)
+        return { -Win, -1, 0, 0 };
+
+    if (grid.IsTerminal())
+        return result;
+
+    // Jogada de reserva caso nem a primeira iteração termine no prazo
+    const typename Game::Moves available{ grid.Available() };
+    result.move = available.Select(0);
+
+    const int maxDepth{ std::min(MaxPly - 1, Game::Size - grid.Stones()) };
+
+    for (int depth{ 1 }; depth <= maxDepth; ++depth)
+    {
+        // A partir da segunda iteração, a janela começa estreita em torno do valor anterior
+        int delta{ Aspiration };
+        int alpha{ depth > 1 ? std::max(result.value - delta, -Win - 1) : -Win - 1 };
+        int beta{ depth > 1 ? std::min(result.value + delta, Win + 1) : Win + 1 };
+        int value;
+
+        for (;;)
+        {
+            value = Negamax(grid, player, depth, 0, alpha, beta, true, context);
+
+            if (context.stop)
+                break;
+
+            // Valor fora da janela: alarga o lado que falhou e repete a iteração
+            if (value <= alpha && alpha > -Win - 1)
+                alpha = std::max(alpha - (delta *= 2), -Win - 1);
+            else if (value >= beta && beta < Win + 1)
+                beta = std::min(beta + (delta *= 2), Win + 1);
+            else
+                break;
+        }
+
+        if (context.stop)
+            break;
+
+        // A variação principal completa guia a próxima iteração
+        context.previous = context.lines[0];
+        context.length = context.ends[0];
+
+        result = { value, context.lines[0][0], depth, 0 };
+
+        // Vitória ou derrota forçada dentro do horizonte: o valor já é exato
+        if (std::abs(value) >= Win - Game::Size)
+            break;
+    }
+
+    result.nodes = context.nodes;
+
+    return result;
+}
+
+//--------------------------------------------------------------------------------------------------
+
+template <int M, int N, int K, typename Evaluate>
+inline int Minimax::Negamax(Grid<M, N, K>& grid, Player player, int depth, int ply, int alpha, int beta, bool principal, Context<Evaluate>& context)
+{
+    context.ends[ply] = ply;
+
+    // Consulta o relógio periodicamente; após o prazo, todos os valores são descartados
+    if (++context.nodes % CheckInterval == 0 && high_resolution_clock::now() >= context.deadline)
+        context.stop = true;
+
+    if (context.stop)
+        return 0;
+
+    if (grid.Winner() != Player::None)
+        return ply - Win;
+
+    if (grid.IsTerminal())
+        return 0;
+
+    // No horizonte, a avaliação fica abaixo de qualquer vitória forçada
+    if (depth == 0)
+    {
+        constexpr int Limit{ Win - M * N - 1 };
+        return std::clamp(context.evaluate(grid, player), -Limit, Limit);
+    }
+
+    // Na variação principal anterior, a jogada dela é tentada primeiro
+    const int first{ principal && ply < context.length ? int(context.previous[ply]) : -1 };
+
+    // Abaixo de qualquer valor real e negável sem estouro, caso o prazo acabe antes do primeiro filho
+    int bestValue{ -Win - 1 };
+
+    auto visit{ [&](int square) {
+        grid.Play(square, player);
+        const int value{ -Negamax(grid, Player(-player), depth - 1, ply + 1, -beta, -alpha, square == first, context) };
+        grid.Undo(square);
+
+        if (context.stop || value <= bestValue)
+            return;
+
+        bestValue = value;
+
+        if (value > alpha)
+        {
+            alpha = value;
+
+            // Nova variação principal: esta jogada seguida da variação do filho
+            auto& line{ context.lines[ply] };
+            line[ply] = int16_t(square);
+            std::copy(&context.lines[ply + 1][ply + 1], &context.lines[ply + 1][context.ends[ply + 1]], &line[ply + 1]);
+            context.ends[ply] = std::max(context.ends[ply + 1], ply + 1);
+        }
+    } };
+
+    if (first >= 0)
+        visit(first);
+
+    grid.Available().ForEach([&](int square) {
+        if (alpha < beta && !context.stop && square != first)
+            visit(square);
+    });
+
+    return bestValue;
+}
+
+//--------------------------------------------------------------------------------------------------
+
+template <int M, int N, int K>
+inline int Minimax::Windows::operator()(const Grid<M, N, K>& grid, Player player) const
+{
+    // Horizontal, vertical e as duas diagonais
+    constexpr int directions[4][2]{ { 0, 1 }, { 1, 0 }, { 1, 1 }, { 1, -1 } };
+    int score{};
+
+    for (int row{}; row < M; ++row)
+    {
+        for (int col{}; col < N; ++col)
+        {
+            for (const auto& [rowStep, colStep] : directions)
+            {
+                const int lastRow{ row + (K - 1) * rowStep }, lastCol{ col + (K - 1) * colStep };
+
+                if (lastRow >= M || lastCol < 0 || lastCol >= N)
+                    continue;
+
+                int own{}, other{};
+                for (int i{}; i < K; ++i)
+                {
+                    const Player stone{ grid.Get((row + i * rowStep) * N + col + i * colStep) };
+                    own += stone == player;
+                    other += stone == Player(-player);
+                }
+
+                // Só janelas sem pedras do adversário ainda podem virar linha
+                if (!other)
+                    score += own * own;
+                else if (!own)
+                    score -= other * other;
+            }
+        }
+    }
+
+    return score;
+}
+
+//--------------------------------------------------------------------------------------------------
+
 #endif
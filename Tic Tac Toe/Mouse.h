@@ -28,46 +28,46 @@ public:
     };
 
     ////////////////////////////////////////////////////////////
-    /// \brief Verifica se um boto do mouse est atualmente pressionado.
+    /// \brief Verifica se um botão do mouse está atualmente pressionado.
     ///
-    /// Este mtodo retorna true enquanto o boto do mouse especificado
+    /// Este método retorna true enquanto o botão do mouse especificado
     /// estiver pressionado.
     ///
-    /// \param button O boto do mouse a ser verificado.
-    /// \return true se o boto estiver pressionado, false caso contrrio.
+    /// \param button O botão do mouse a ser verificado.
+    /// \return true se o botão estiver pressionado, false caso contrário.
     /// 
     ////////////////////////////////////////////////////////////
     static bool ButtonPressed(MouseButton button);
 
     ////////////////////////////////////////////////////////////
-    /// \brief Retorna true uma vez quando o boto do mouse  pressionado.
+    /// \brief Retorna true uma vez quando o botão do mouse é pressionado.
     ///
-    /// Este mtodo detecta o evento de pressionamento do boto e retorna
+    /// Este método detecta o evento de pressionamento do botão e retorna
     /// true apenas uma vez durante o ciclo de pressionamento. Subsequentemente,
-    /// retornar false at que o boto seja liberado e pressionado novamente.
+    /// retornará false até que o botão seja liberado e pressionado novamente.
     ///
-    /// \param button O boto do mouse a ser verificado.
-    /// \return true uma vez se o boto foi pressionado, false caso contrrio.
+    /// \param button O botão do mouse a ser verificado.
+    /// \return true uma vez se o botão foi pressionado, false caso contrário.
     /// 
     ////////////////////////////////////////////////////////////
     static bool ButtonDown(MouseButton button);
 
     ////////////////////////////////////////////////////////////
-    /// \brief Obtm a posio atual do mouse em coordenadas globais.
+    /// \brief Obtém a posição atual do mouse em coordenadas globais.
     ///
-    /// Este mtodo retorna a posio do cursor do mouse na tela, em relao
-    /// s coordenadas globais (geralmente a posio em relao  tela principal).
+    /// Este método retorna a posição do cursor do mouse na tela, em relação
+    /// às coordenadas globais (geralmente a posição em relação à tela principal).
     ///
-    /// \return A posio global do mouse como um vetor de coordenadas (x, y).
+    /// \return A posição global do mouse como um vetor de coordenadas (x, y).
     /// 
     ////////////////////////////////////////////////////////////
     static const Vector2i& Position();
     static const MouseState& Position(const Rect& viewport);
 
     ////////////////////////////////////////////////////////////
-    /// \brief Define a posio global do cursor do mouse.
+    /// \brief Define a posição global do cursor do mouse.
     ///
-    /// Este mtodo move o cursor do mouse para uma posio especfica
+    /// Este método move o cursor do mouse para uma posição específica
     /// em coordenadas globais (na tela inteira).
     ///
     /// \param x A nova coordenada x do cursor.
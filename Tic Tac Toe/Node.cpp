@@ -1,113 +1,61 @@
 #include "Node.h"
-#include <cmath>
+#include "Playout.h"
+#include "Policy.h"
 
 //--------------------------------------------------------------------------------------------------
 
-std::mt19937 Node::mt{ std::random_device{}() };
+// O nó cabe em meia linha de cache: árvores com milhões de nós ocupam poucas centenas de MB
+static_assert(sizeof(Node) <= 32);
 
 //--------------------------------------------------------------------------------------------------
 
-Node::Node(const Board& board, Player nextPlayer, Node* parent) :
-	board{ board },
-	nextPlayer{ nextPlayer },
+Node::Node(const Board& board, uint32_t parent, int move) :
 	parent{ parent },
-	isTerminal{ board.CheckWinner() != Player::None },
+	firstChild{ Null },
 	visits{},
-	score{}	
+	score{},
+	amafVisits{},
+	amafScore{},
+	childCount{},
+	explored{},
+	move{ int8_t(move) },
+	nextPlayer{ int8_t(board.Turn()) },
+	isTerminal{ board.CheckWinner() != Player::None || board.Available() == 0 },
+	proof{ isTerminal ? (board.CheckWinner() != Player::None ? Loss : Draw) : board.IsDeadDraw() ? Draw : Unknown }
 {
-	if (!isTerminal)
-	{
-		this->board.GetAvailableMoves(unexploredMoves);
-		isTerminal = unexploredMoves.empty();
-	}
 }
 
 //--------------------------------------------------------------------------------------------------
 
-Node* Node::Select(float explorationConstant)
+float Node::Rollout(const Board& position, Random& random, int count, Board* final)
 {
-	// Caso haja movimentos no explorados
-	if (!unexploredMoves.empty())
-	{
-		// Faz jogada no tabuleiro para gerar n sucessor
-		auto move{ unexploredMoves.back() };
-		unexploredMoves.pop_back();
-		*move = nextPlayer;
-
-		// Instacia o n sucessor
-		adjacent.emplace_back(std::make_unique<Node>(board, Player(-nextPlayer), this));
-
-		// Restaura o estado original do tabuleiro
-		*move = Player::None;
-
-		// Retorna o n sucessor
-		return adjacent.back().get();
-	}
+	// Verifica se a posição é terminal
+	Player winner{ position.CheckWinner() };
+	const bool isTerminal{ winner != Player::None || position.Available() == 0 };
 
-	// Se o n no for terminal retorna um sucessor com base no UCB1
-	if (!isTerminal)
+	// Várias simulações em lote reduzem a variância da estimativa do nó (aleatórias, sem tabuleiro final)
+	if (count > 1 && !isTerminal)
 	{
-		float bestValue{ -std::numeric_limits<float>::infinity() };
-		std::vector<Node*> bestAdjacent;
-
-		// Seleciona os ns mais promissores usando UCB1
-		for (auto& adj : adjacent)
-		{
-			// Calcula o score da perspectiva do jogador atual
-			float adjScore{ nextPlayer == Player::O ? adj->score : -adj->score };
-
-			// Calcula o UCB1
-			const float exploitation{ adjScore / adj->visits };
-			const float exploration{ explorationConstant * std::sqrtf(std::logf(float(visits)) / adj->visits) };
-			const float ucbValue{ exploitation + exploration };
-
-			// Se o valor encontrado for melhor que o anterior, reseta o vetor
-			if (ucbValue > bestValue)
-			{
-				bestAdjacent.clear();
-				bestValue = ucbValue;
-			}
-
-			// Adiciona o n promissor ao vetor
-			if (std::fabs(ucbValue - bestValue) < 1e-6f)
-				bestAdjacent.push_back(adj.get());
-		}
+		if (final)
+			*final = position;
 
-		// Retorna um dos sucessores mais promissores
-		std::uniform_int_distribution<size_t> dist{ 0, bestAdjacent.size() - 1 };
-		return bestAdjacent[dist(mt)];
+		return float(Playout::Run(position, position.Turn(), count, random)) / count;
 	}
 
-	return this;
-}
-
-//--------------------------------------------------------------------------------------------------
-
-float Node::Rollout() const
-{
-	Player winner{};
+	// Instancia uma cópia do tabuleiro
+	Board board{ position };
 
-	// Verifica se o n  terminal
-	if (isTerminal)
-		winner = board.CheckWinner();
-	else
+	if (!isTerminal)
 	{
-		// Instancia uma cpia do tabuleiro
-		Board board{ this->board };
-
-		// Carrega os movimentos vlidos
-		std::vector<Player*> moves;
-		board.GetAvailableMoves(moves);
-
-		// Embaralha os movimentos
-		std::shuffle(moves.begin(), moves.end(), mt);
-
-		// Faz jogadas aleatrias (simulao)
-		for (Player player{ this->nextPlayer }; auto& move : moves)
+		// Faz jogadas escolhidas pela política de simulação (resolvida em tempo de compilação)
+		// até alguém vencer ou nenhuma linha poder mais ser completada (inclui o tabuleiro cheio)
+		for (Player player{ board.Turn() }; !board.IsDeadDraw();)
 		{
-			*move = player;
+			const int move{ RolloutPolicy::Choose(board.Occupied(player), board.Occupied(Player(-player)), board.Available(), random) };
 
-			// Verifica se h vencedor aps cada jogada
+			board.MakeMove(move);
+
+			// Verifica se há vencedor após cada jogada (contadores das linhas, O(1))
 			if (winner = board.CheckWinner(); winner != None)
 				break;
 
@@ -116,21 +64,12 @@ float Node::Rollout() const
 		}
 	}
 
+	// Tabuleiro final, usado para as estatísticas AMAF
+	if (final)
+		*final = board;
+
 	// Retorna o resultado da perspectiva da IA (Player::O)
 	return winner == Player::O ? 1.f : winner == Player::X ? -1.f : 0.f;
 }
 
 //--------------------------------------------------------------------------------------------------
-
-void Node::Backpropagate(float score)
-{
-	Node* node{ this };
-	while (node != nullptr)
-	{
-		node->visits++;
-		node->score += score;
-		node = node->parent;
-	}
-}
-
-//--------------------------------------------------------------------------------------------------
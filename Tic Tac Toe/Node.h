@@ -4,37 +4,53 @@
 //--------------------------------------------------------------------------------------------------
 
 #include "Board.h"
-#include <vector>
-#include <memory>
-#include <random>
+#include "Random.h"
+
+namespace MCTS { class Tree; }
 
 //--------------------------------------------------------------------------------------------------
 
 class Node
 {
 public:
-	Node(const Board& board, Player nextPlayer, Node* parent);
-
-	Node* Select(float explorationConstant);
-	float Rollout() const;
-	void Backpropagate(float score);
+	static constexpr uint32_t Null{ ~0u };
+	static constexpr uint32_t Busy{ Null - 1 }; // Expansão em andamento em outra thread
+
+	// Resultado provado para o jogador da vez no nó (MCTS-Solver)
+	enum Proof : uint8_t
+	{
+		Unknown,
+		Win,
+		Loss,
+		Draw,
+	};
+
+	Node() = default;
+	Node(const Board& board, uint32_t parent, int move);
+
+	static float Rollout(const Board& board, Random& random, int count = 1, Board* final = nullptr);
 	bool IsTerminal() const;
-	const int& Visits() const;	
-	void GetBoard(Board& board);
+	Proof Proven() const;
+	bool IsExpanded() const;
+	const int& Visits() const;
+	Player NextPlayer() const;
 
 private:
-	using NodePtr = std::unique_ptr<Node>;
+	friend class MCTS::Tree;
 
-	static std::mt19937	 mt;
-
-	Board				 board;
-	const Player		 nextPlayer;
-	Node*				 parent;
-	bool				 isTerminal;
+	// O nó não guarda o tabuleiro: a posição é refeita na descida, aplicando as jogadas desde a raiz
+	uint32_t			 parent;
+	uint32_t			 firstChild;	// Filhos contíguos na arena: [firstChild, firstChild + childCount)
 	int					 visits;
 	float				 score;
-	std::vector<Player*> unexploredMoves;
-	std::vector<NodePtr> adjacent;
+	int					 amafVisits;	// Simulações em que a jogada foi feita depois do pai (RAVE)
+	float				 amafScore;
+	uint8_t				 childCount;
+	uint8_t				 explored;		// Filhos já visitados ao menos uma vez
+	int8_t				 move;			// Jogada que levou a este nó
+	int8_t				 nextPlayer;	// Player
+	bool				 isTerminal;
+	Proof				 proof;
 };
 
 //--------------------------------------------------------------------------------------------------
@@ -46,6 +62,20 @@ inline bool Node::IsTerminal() const
 
 //--------------------------------------------------------------------------------------------------
 
+inline Node::Proof Node::Proven() const
+{
+	return proof;
+}
+
+//--------------------------------------------------------------------------------------------------
+
+inline bool Node::IsExpanded() const
+{
+	return firstChild < Busy;
+}
+
+//--------------------------------------------------------------------------------------------------
+
 inline const int& Node::Visits() const
 {
 	return visits;
@@ -53,9 +83,9 @@ inline const int& Node::Visits() const
 
 //--------------------------------------------------------------------------------------------------
 
-inline void Node::GetBoard(Board& board)
+inline Player Node::NextPlayer() const
 {
-	board = this->board;
+	return Player(nextPlayer);
 }
 
 //--------------------------------------------------------------------------------------------------
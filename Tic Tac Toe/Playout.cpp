@@ -0,0 +1,299 @@
+#include "Playout.h"
+#include <algorithm>
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+#define QUANTVERSO_X86
+#include <immintrin.h>
+#ifdef _MSC_VER
+#include <intrin.h>
+#define QUANTVERSO_TARGET(instructions)
+#else
+#define QUANTVERSO_TARGET(instructions) __attribute__((target(instructions)))
+#endif
+#endif
+
+//--------------------------------------------------------------------------------------------------
+
+namespace
+{
+	// Máscara de faixas ativas: ler a partir de [Lanes - n] liga as n primeiras faixas
+	alignas(32) constexpr uint16_t laneMask[2 * Playout::Lanes]
+	{
+		0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+		0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+	};
+}
+
+//--------------------------------------------------------------------------------------------------
+
+Playout::Instructions Playout::selected{ Playout::Supported() };
+
+//--------------------------------------------------------------------------------------------------
+
+int Playout::Run(const Board& board, Player player, int count, Random& random)
+{
+	const Board::Mask o{ board.Occupied(Player::O) };
+	const Board::Mask x{ board.Occupied(Player::X) };
+
+	// Posição terminal: todas as simulações têm o mesmo resultado
+	if (Board::HasLine(o))
+		return count;
+
+	if (Board::HasLine(x))
+		return -count;
+
+	// Empate decidido: nenhuma linha pode mais ser completada
+	if (board.IsDeadDraw())
+		return 0;
+
+	std::array<int8_t, Board::Size> empty;
+	int plies{};
+
+	for (Board::Mask available{ board.Available() }; available; available &= available - 1)
+		empty[plies++] = int8_t(std::countr_zero(available));
+
+	if (plies == 0)
+		return 0;
+
+	// Índice de quem joga no primeiro lance: 0 = O, 1 = X
+	const int first{ player == Player::X };
+	Batch batch;
+	int total{};
+
+	for (int done{}; done < count; done += Lanes)
+	{
+		const int lanes{ std::min(Lanes, count - done) };
+
+		// Cada faixa joga as casas livres numa ordem aleatória (Fisher-Yates)
+		for (int lane{}; lane < Lanes; ++lane)
+		{
+			auto order{ empty };
+
+			for (int ply{}; ply < plies; ++ply)
+			{
+				if (lane < lanes)
+					std::swap(order[ply], order[ply + random.Below(uint32_t(plies - ply))]);
+
+				batch.moves[ply][lane] = lane < lanes ? uint16_t(1 << order[ply]) : 0;
+			}
+		}
+
+		total += Simulate(selected, o, x, first, batch, plies, lanes);
+	}
+
+	return total;
+}
+
+//--------------------------------------------------------------------------------------------------
+
+Playout::Instructions Playout::Supported()
+{
+#ifdef QUANTVERSO_X86
+#ifdef _MSC_VER
+	int info[4];
+	__cpuid(info, 0);
+
+	if (info[0] >= 7)
+	{
+		// AVX2 exige suporte da CPU e do sistema operacional (registradores YMM salvos)
+		__cpuid(info, 1);
+		const bool avx{ (info[2] & (1 << 27)) && (info[2] & (1 << 28)) && (_xgetbv(0) & 6) == 6 };
+
+		__cpuidex(info, 7, 0);
+		if (avx && (info[1] & (1 << 5)))
+			return AVX2;
+	}
+
+	return SSE2;
+#else
+	__builtin_cpu_init();
+	return __builtin_cpu_supports("avx2") ? AVX2 : SSE2;
+#endif
+#else
+	return Scalar;
+#endif
+}
+
+//--------------------------------------------------------------------------------------------------
+
+const char* Playout::Name(Instructions instructions)
+{
+	switch (instructions)
+	{
+	case AVX2:
+		return "avx2";
+
+	case SSE2:
+		return "sse2";
+
+	default:
+		return "scalar";
+	}
+}
+
+//--------------------------------------------------------------------------------------------------
+
+void Playout::Use(Instructions instructions)
+{
+	selected = std::min(instructions, Supported());
+}
+
+//--------------------------------------------------------------------------------------------------
+
+int Playout::Simulate(Instructions instructions, Board::Mask o, Board::Mask x, int first, const Batch& batch, int plies, int lanes)
+{
+	switch (instructions)
+	{
+	case AVX2:
+		return SimulateAVX2(o, x, first, batch, plies, lanes);
+
+	case SSE2:
+		return SimulateSSE2(o, x, first, batch, plies, lanes);
+
+	default:
+		return SimulateScalar(o, x, first, batch, plies, lanes);
+	}
+}
+
+//--------------------------------------------------------------------------------------------------
+
+int Playout::SimulateScalar(Board::Mask o, Board::Mask x, int first, const Batch& batch, int plies, int lanes)
+{
+	int total{};
+
+	for (int lane{}; lane < lanes; ++lane)
+	{
+		Board::Mask own[2]{ o, x };
+
+		for (int ply{}; ply < plies; ++ply)
+		{
+			const int side{ first ^ (ply & 1) };
+			own[side] |= batch.moves[ply][lane];
+
+			if (Board::HasLine(own[side]))
+			{
+				total += side == 0 ? 1 : -1;
+				break;
+			}
+		}
+	}
+
+	return total;
+}
+
+//--------------------------------------------------------------------------------------------------
+
+#ifdef QUANTVERSO_X86
+QUANTVERSO_TARGET("sse2")
+#endif
+int Playout::SimulateSSE2(Board::Mask o, Board::Mask x, int first, const Batch& batch, int plies, int lanes)
+{
+#ifdef QUANTVERSO_X86
+	// Duas metades de 8 faixas: [jogador][metade]
+	__m128i own[2][2]{
+		{ _mm_set1_epi16(short(o)), _mm_set1_epi16(short(o)) },
+		{ _mm_set1_epi16(short(x)), _mm_set1_epi16(short(x)) },
+	};
+
+	__m128i active[2]{
+		_mm_loadu_si128(reinterpret_cast<const __m128i*>(laneMask + Lanes - lanes)),
+		_mm_loadu_si128(reinterpret_cast<const __m128i*>(laneMask + Lanes - lanes + 8)),
+	};
+
+	__m128i result[2]{ _mm_setzero_si128(), _mm_setzero_si128() };
+
+	__m128i lines[Board::Lines];
+	for (int line{}; line < Board::Lines; ++line)
+		lines[line] = _mm_set1_epi16(short(Board::Line(line)));
+
+	for (int ply{}; ply < plies; ++ply)
+	{
+		const int side{ first ^ (ply & 1) };
+
+		for (int half{}; half < 2; ++half)
+		{
+			// Apenas partidas em andamento recebem a jogada
+			const __m128i move{ _mm_load_si128(reinterpret_cast<const __m128i*>(&batch.moves[ply][8 * half])) };
+			__m128i& stones{ own[side][half] };
+			stones = _mm_or_si128(stones, _mm_and_si128(move, active[half]));
+
+			// Faixas com alguma linha completa ficam com todos os bits ligados (-1)
+			__m128i win{ _mm_setzero_si128() };
+			for (const __m128i& line : lines)
+				win = _mm_or_si128(win, _mm_cmpeq_epi16(_mm_and_si128(stones, line), line));
+
+			win = _mm_and_si128(win, active[half]);
+			result[half] = side == 0 ? _mm_sub_epi16(result[half], win) : _mm_add_epi16(result[half], win);
+			active[half] = _mm_andnot_si128(win, active[half]);
+		}
+
+		if (_mm_movemask_epi8(_mm_or_si128(active[0], active[1])) == 0)
+			break;
+	}
+
+	alignas(16) int16_t scores[Lanes];
+	_mm_store_si128(reinterpret_cast<__m128i*>(scores), result[0]);
+	_mm_store_si128(reinterpret_cast<__m128i*>(scores + 8), result[1]);
+
+	int total{};
+	for (const int16_t score : scores)
+		total += score;
+
+	return total;
+#else
+	return SimulateScalar(o, x, first, batch, plies, lanes);
+#endif
+}
+
+//--------------------------------------------------------------------------------------------------
+
+#ifdef QUANTVERSO_X86
+QUANTVERSO_TARGET("avx2")
+#endif
+int Playout::SimulateAVX2(Board::Mask o, Board::Mask x, int first, const Batch& batch, int plies, int lanes)
+{
+#ifdef QUANTVERSO_X86
+	// As 16 faixas cabem em um registrador: [jogador]
+	__m256i own[2]{ _mm256_set1_epi16(short(o)), _mm256_set1_epi16(short(x)) };
+	__m256i active{ _mm256_loadu_si256(reinterpret_cast<const __m256i*>(laneMask + Lanes - lanes)) };
+	__m256i result{ _mm256_setzero_si256() };
+
+	__m256i lines[Board::Lines];
+	for (int line{}; line < Board::Lines; ++line)
+		lines[line] = _mm256_set1_epi16(short(Board::Line(line)));
+
+	for (int ply{}; ply < plies; ++ply)
+	{
+		const int side{ first ^ (ply & 1) };
+
+		// Apenas partidas em andamento recebem a jogada
+		const __m256i move{ _mm256_load_si256(reinterpret_cast<const __m256i*>(batch.moves[ply])) };
+		own[side] = _mm256_or_si256(own[side], _mm256_and_si256(move, active));
+
+		// Faixas com alguma linha completa ficam com todos os bits ligados (-1)
+		__m256i win{ _mm256_setzero_si256() };
+		for (const __m256i& line : lines)
+			win = _mm256_or_si256(win, _mm256_cmpeq_epi16(_mm256_and_si256(own[side], line), line));
+
+		win = _mm256_and_si256(win, active);
+		result = side == 0 ? _mm256_sub_epi16(result, win) : _mm256_add_epi16(result, win);
+		active = _mm256_andnot_si256(win, active);
+
+		if (_mm256_testz_si256(active, active))
+			break;
+	}
+
+	alignas(32) int16_t scores[Lanes];
+	_mm256_store_si256(reinterpret_cast<__m256i*>(scores), result);
+
+	int total{};
+	for (const int16_t score : scores)
+		total += score;
+
+	return total;
+#else
+	return SimulateScalar(o, x, first, batch, plies, lanes);
+#endif
+}
+
+//--------------------------------------------------------------------------------------------------
@@ -0,0 +1,65 @@
+#ifndef QUANTVERSO_PLAYOUT_H
+#define QUANTVERSO_PLAYOUT_H
+
+//--------------------------------------------------------------------------------------------------
+
+#include "Board.h"
+#include "Random.h"
+
+//--------------------------------------------------------------------------------------------------
+
+////////////////////////////////////////////////////////////
+/// class Playout
+/// \brief Simulações aleatórias em lote sobre bitboards.
+///
+/// Até 16 partidas avançam juntas, uma por faixa de 16 bits
+/// de um registrador AVX2 (ou duas metades SSE2), e a vitória
+/// é testada contra as oito linhas de uma só vez. Sem essas
+/// instruções, o mesmo lote é jogado por um laço escalar.
+///
+////////////////////////////////////////////////////////////
+class Playout
+{
+public:
+    enum Instructions
+    {
+        Scalar,
+        SSE2,
+        AVX2,
+    };
+
+    static constexpr int Lanes{ 16 };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Joga `count` simulações a partir de `board`.
+    ///
+    /// \return Soma dos resultados da perspectiva de O
+    ///         (+1 vitória de O, -1 vitória de X, 0 empate).
+    ///
+    ////////////////////////////////////////////////////////////
+    static int Run(const Board& board, Player player, int count, Random& random);
+
+    static Instructions Supported();
+    static const char* Name(Instructions instructions);
+
+    // Força um conjunto de instruções (limitado ao suportado pela CPU)
+    static void Use(Instructions instructions);
+
+private:
+    // Jogadas sorteadas de um lote: [lance][faixa] = bit da casa
+    struct alignas(32) Batch
+    {
+        uint16_t moves[Board::Size][Lanes];
+    };
+
+    static int Simulate(Instructions instructions, Board::Mask o, Board::Mask x, int first, const Batch& batch, int plies, int lanes);
+    static int SimulateScalar(Board::Mask o, Board::Mask x, int first, const Batch& batch, int plies, int lanes);
+    static int SimulateSSE2(Board::Mask o, Board::Mask x, int first, const Batch& batch, int plies, int lanes);
+    static int SimulateAVX2(Board::Mask o, Board::Mask x, int first, const Batch& batch, int plies, int lanes);
+
+    static Instructions selected;
+};
+
+//--------------------------------------------------------------------------------------------------
+
+#endif
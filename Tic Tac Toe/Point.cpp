@@ -20,12 +20,12 @@ Point::Point(const Vector2i& position)
 
 void Point::Draw(Window* window) const
 {
-	constexpr int radius{ 3 }; // Distncia dos pontos ao redor do ponto central
+	constexpr int radius{ 3 }; // Distância dos pontos ao redor do ponto central
 	constexpr int offset{ radius - 1 };
 
 	window->SetRenderDrawColor(color);
 
-	// Desenha um retngulo sobre o ponto central
+	// Desenha um retângulo sobre o ponto central
 	Rect rect{
 		int(position.x) - offset,
 		int(position.y) - offset,
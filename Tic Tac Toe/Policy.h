@@ -0,0 +1,125 @@
+#ifndef QUANTVERSO_POLICY_H
+#define QUANTVERSO_POLICY_H
+
+//--------------------------------------------------------------------------------------------------
+
+#include "Board.h"
+#include "Random.h"
+
+//--------------------------------------------------------------------------------------------------
+
+////////////////////////////////////////////////////////////
+/// Políticas de simulação do MCTS.
+///
+/// Uma política é um tipo com `Name` e uma função estática
+/// Choose(própria, adversário, livres, gerador) que retorna a
+/// casa a jogar. A política usada por Node::Rollout é escolhida
+/// em tempo de compilação por QUANTVERSO_ROLLOUT_POLICY, sem
+/// custo de despacho no laço da simulação.
+///
+////////////////////////////////////////////////////////////
+namespace Policy
+{
+	// Jogada uniforme entre as casas livres
+	struct Random
+	{
+		static constexpr const char* Name{ "random" };
+
+		static int Choose(Board::Mask own, Board::Mask opponent, Board::Mask available, ::Random& random);
+	};
+
+	// Vence se puder, senão bloqueia, senão sorteia com peso pelas linhas que passam pela casa
+	struct Tactical
+	{
+		static constexpr const char* Name{ "tactical" };
+
+		static int Choose(Board::Mask own, Board::Mask opponent, Board::Mask available, ::Random& random);
+
+		// Casas que completam uma linha para quem tem as pedras `stones`
+		static Board::Mask Threats(Board::Mask stones);
+
+	private:
+		static constexpr std::array<Board::Mask, Board::Full + 1> threats{ [] {
+			std::array<Board::Mask, Board::Full + 1> squares{};
+
+			// Linhas com duas pedras: a casa restante é uma ameaça
+			for (int stones{}; stones <= Board::Full; ++stones)
+			{
+				for (int line{}; line < Board::Lines; ++line)
+				{
+					const Board::Mask rest{ Board::Mask(Board::Line(line) & ~stones) };
+					if (std::popcount(rest) == 1)
+						squares[stones] |= rest;
+				}
+			}
+
+			return squares;
+		}() };
+	};
+
+	// Índice do `n`-ésimo bit ligado da máscara
+	int Nth(Board::Mask mask, int n);
+}
+
+#ifndef QUANTVERSO_ROLLOUT_POLICY
+#define QUANTVERSO_ROLLOUT_POLICY Policy::Random
+#endif
+
+using RolloutPolicy = QUANTVERSO_ROLLOUT_POLICY;
+
+//--------------------------------------------------------------------------------------------------
+
+inline int Policy::Nth(Board::Mask mask, int n)
+{
+	for (; n > 0; --n)
+		mask &= mask - 1;
+
+	return std::countr_zero(mask);
+}
+
+//--------------------------------------------------------------------------------------------------
+
+inline int Policy::Random::Choose(Board::Mask, Board::Mask, Board::Mask available, ::Random& random)
+{
+	return Nth(available, int(random.Below(uint32_t(std::popcount(available)))));
+}
+
+//--------------------------------------------------------------------------------------------------
+
+inline Board::Mask Policy::Tactical::Threats(Board::Mask stones)
+{
+	return threats[stones];
+}
+
+//--------------------------------------------------------------------------------------------------
+
+inline int Policy::Tactical::Choose(Board::Mask own, Board::Mask opponent, Board::Mask available, ::Random& random)
+{
+	// Primeiro as vitórias imediatas, depois os bloqueios
+	Board::Mask candidates{ Board::Mask(Threats(own) & available) };
+
+	if (!candidates)
+		candidates = Threats(opponent) & available;
+
+	if (candidates)
+		return Nth(candidates, int(random.Below(uint32_t(std::popcount(candidates)))));
+
+	// Sorteio com peso 4 no centro, 3 nos cantos e 2 nas bordas
+	uint32_t total{};
+	for (Board::Mask moves{ available }; moves; moves &= moves - 1)
+		total += Board::LinesThrough(std::countr_zero(moves));
+
+	int weight{ int(random.Below(total)) };
+
+	for (Board::Mask moves{ available };; moves &= moves - 1)
+	{
+		const int square{ std::countr_zero(moves) };
+
+		if ((weight -= Board::LinesThrough(square)) < 0)
+			return square;
+	}
+}
+
+//--------------------------------------------------------------------------------------------------
+
+#endif
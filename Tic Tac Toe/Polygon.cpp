@@ -29,11 +29,11 @@ Polygon::~Polygon()
 
 void Polygon::Refresh()
 {
-	// Clculo de seno e cosseno
+	// Cálculo de seno e cosseno
 	float cosAngle{ cosf(this->angle.radians) };
 	float sinAngle{ sinf(this->angle.radians) };
 
-	// Aplica a rotao e atualiza vertices
+	// Aplica a rotação e atualiza vertices
 	for (int i{}; i < size; ++i)
 	{
 		float rotatedX{ origin[i].x * cosAngle - origin[i].y * sinAngle };
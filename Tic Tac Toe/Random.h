@@ -0,0 +1,106 @@
+#ifndef QUANTVERSO_RANDOM_H
+#define QUANTVERSO_RANDOM_H
+
+//--------------------------------------------------------------------------------------------------
+
+#include <array>
+#include <cstdint>
+#include <limits>
+
+//--------------------------------------------------------------------------------------------------
+
+////////////////////////////////////////////////////////////
+/// class Random
+/// \brief Gerador xoshiro256** de 32 bytes de estado.
+///
+/// Cada thread deve ter o seu. Below() sorteia inteiros em
+/// [0, limite) sem viés pelo método de Lemire, com uma
+/// multiplicação e quase nunca uma rejeição.
+///
+////////////////////////////////////////////////////////////
+class Random
+{
+public:
+	using result_type = uint64_t;
+
+	explicit Random(uint64_t seed = 0);
+
+	void Seed(uint64_t seed);
+	uint64_t operator()();
+	uint32_t Below(uint32_t bound);
+
+	static constexpr result_type min() { return 0; }
+	static constexpr result_type max() { return std::numeric_limits<result_type>::max(); }
+
+private:
+	static constexpr uint64_t Rotate(uint64_t value, int bits);
+
+	std::array<uint64_t, 4> state;
+};
+
+//--------------------------------------------------------------------------------------------------
+
+inline Random::Random(uint64_t seed)
+{
+	Seed(seed);
+}
+
+//--------------------------------------------------------------------------------------------------
+
+inline void Random::Seed(uint64_t seed)
+{
+	// O estado é expandido com SplitMix64, nunca ficando todo zerado
+	for (auto& word : state)
+	{
+		uint64_t z{ seed += 0x9E3779B97F4A7C15 };
+		z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9;
+		z = (z ^ (z >> 27)) * 0x94D049BB133111EB;
+		word = z ^ (z >> 31);
+	}
+}
+
+//--------------------------------------------------------------------------------------------------
+
+inline constexpr uint64_t Random::Rotate(uint64_t value, int bits)
+{
+	return (value << bits) | (value >> (64 - bits));
+}
+
+//--------------------------------------------------------------------------------------------------
+
+inline uint64_t Random::operator()()
+{
+	const uint64_t result{ Rotate(state[1] * 5, 7) * 9 };
+	const uint64_t t{ state[1] << 17 };
+
+	state[2] ^= state[0];
+	state[3] ^= state[1];
+	state[1] ^= state[2];
+	state[0] ^= state[3];
+	state[2] ^= t;
+	state[3] = Rotate(state[3], 45);
+
+	return result;
+}
+
+//--------------------------------------------------------------------------------------------------
+
+inline uint32_t Random::Below(uint32_t bound)
+{
+	// Os 32 bits altos multiplicados pelo limite; rejeita só a faixa que causaria viés
+	uint64_t product{ ((*this)() >> 32) * bound };
+
+	if (uint32_t(product) < bound)
+	{
+		const uint32_t threshold{ uint32_t(-bound) % bound };
+
+		while (uint32_t(product) < threshold)
+			product = ((*this)() >> 32) * bound;
+	}
+
+	return uint32_t(product >> 32);
+}
+
+//--------------------------------------------------------------------------------------------------
+
+#endif
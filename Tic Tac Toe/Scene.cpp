@@ -4,7 +4,7 @@
 
 // ------------------------------------------------------------------------------------------------
 
-Window& Scene::window{ Engine::window };	   ///< Janela grfica
+Window& Scene::window{ Engine::window };	   ///< Janela gráfica
 float&  Scene::deltaTime{ Engine::deltaTime }; ///< Tempo decorrido entre frames
 
 // ------------------------------------------------------------------------------------------------
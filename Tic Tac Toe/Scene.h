@@ -27,7 +27,7 @@ class Scene
 {
 public:
 	////////////////////////////////////////////////////////////
-	/// \brief Construtor padro.
+	/// \brief Construtor padrão.
 	/// 
 	////////////////////////////////////////////////////////////
 	Scene();
@@ -41,7 +41,7 @@ public:
 	////////////////////////////////////////////////////////////
 	/// \brief Inicializa objetos derivados desta classe.
 	/// 
-	///  obrigatrio implement-lo nas classes derivadas.
+	/// É obrigatório implementá-lo nas classes derivadas.
 	/// 
 	////////////////////////////////////////////////////////////
 	virtual void Start() = 0;
@@ -49,16 +49,16 @@ public:
 	////////////////////////////////////////////////////////////
 	/// \brief Atualiza objetos derivados desta classe.
 	/// 
-	/// Mtodo virtual chamado a cada frame para atualizar objetos.
+	/// Método virtual chamado a cada frame para atualizar objetos.
 	/// Pode ser implementado pelas classes derivadas.
 	/// 
 	////////////////////////////////////////////////////////////
 	virtual void Update() {};
 
 	////////////////////////////////////////////////////////////
-	/// \brief Desenha todo contudo da cena.
+	/// \brief Desenha todo contéudo da cena.
 	/// 
-	/// Chama o mtodo Draw() da cena, Draw() das entidades e
+	/// Chama o método Draw() da cena, Draw() das entidades e
 	/// DrawOver() da cena nesta ordem.
 	/// 
 	////////////////////////////////////////////////////////////
@@ -67,17 +67,17 @@ public:
 	////////////////////////////////////////////////////////////
 	/// \brief Atualiza entidades da cena.
 	/// 
-	/// Chama o mtodo Update() para cada objeto registrado,
+	/// Chama o método Update() para cada objeto registrado,
 	/// atualizando seu estado.
 	/// 
 	////////////////////////////////////////////////////////////
 	void UpdateObjects();
 
 	////////////////////////////////////////////////////////////
-	/// \brief Destri entidades solicitadas.
+	/// \brief Destrói entidades solicitadas.
 	///
-	/// Este mtodo  responsvel por deletar entidades cujo
-	/// mtodo Destroy() foi invocado no frame atual.
+	/// Este método é responsável por deletar entidades cujo
+	/// método Destroy() foi invocado no frame atual.
 	///
 	////////////////////////////////////////////////////////////
 	void DestroyObjects();
@@ -85,16 +85,16 @@ public:
 	////////////////////////////////////////////////////////////
 	/// \brief Instancia um objeto na cena.
 	///
-	/// Se o ID (nico) for informado, o objeto ser adicionado
-	///  tabela hash e poder ser recuperado posteriormente
-	/// usando o mtodo FindObject(). O objeto ser destrudo
+	/// Se o ID (único) for informado, o objeto será adicionado
+	/// à tabela hash e poderá ser recuperado posteriormente
+	/// usando o método FindObject(). O objeto será destruído
 	/// automaticamente quando o destrutor da cena for chamado.
 	///
 	/// \tparam T O tipo de objeto a ser instanciado.
 	/// 
 	/// \param id (Opcional) A chave que identifica a entidade 
-	/// a ser instanciada. Se no fornecida ou no for nica,
-	/// o objeto no ser registrado na tabela hash.
+	/// a ser instanciada. Se não fornecida ou não for única,
+	/// o objeto não será registrado na tabela hash.
 	/// 
 	/// \return Um ponteiro para o objeto do tipo `T`.
 	///
@@ -103,26 +103,26 @@ public:
 	T* CreateObject(const char* id = nullptr, Args&&... args);
 
 	////////////////////////////////////////////////////////////
-	/// \brief Adiciona um objeto existente  cena.
+	/// \brief Adiciona um objeto existente à cena.
 	///
-	/// Se o ID (nico) for informado, o objeto ser adicionado
-	///  tabela hash e poder ser recuperado posteriormente
-	/// usando o mtodo FindObject(). O objeto no ser destrudo
-	/// pela cena (precisa ser destrudo manualmente).
+	/// Se o ID (único) for informado, o objeto será adicionado
+	/// à tabela hash e poderá ser recuperado posteriormente
+	/// usando o método FindObject(). O objeto não será destruído
+	/// pela cena (precisa ser destruído manualmente).
 	///
 	/// \tparam T O tipo de objeto a ser instanciado.
 	/// 
 	/// \param id (Opcional) A chave que identifica a entidade 
-	/// a ser instanciada. Se no fornecida ou no for nica,
-	/// o objeto no ser registrado na tabela hash.
+	/// a ser instanciada. Se não fornecida ou não for única,
+	/// o objeto não será registrado na tabela hash.
 	///
 	////////////////////////////////////////////////////////////
 	void AddObject(Entity* obj, const char* id);
 
 	////////////////////////////////////////////////////////////
-	/// \brief Encontra um objeto registrado pelo nome e retorna o tipo especfico.
+	/// \brief Encontra um objeto registrado pelo nome e retorna o tipo específico.
 	///
-	/// Este mtodo genrico busca um objeto pelo seu id (chave) na
+	/// Este método genérico busca um objeto pelo seu id (chave) na
 	/// tabela de objetos. Se o objeto for encontrado,
 	/// retorna um ponteiro para o tipo derivado.
 	///
@@ -131,7 +131,7 @@ public:
 	/// \param id A chave que identifica a entidade a ser buscada.
 	/// 
 	/// \return Um ponteiro para o tipo `T` se a entidade for encontrada e
-	/// corresponder ao tipo; caso contrrio, retorna `nullptr`.
+	/// corresponder ao tipo; caso contrário, retorna `nullptr`.
 	///
 	////////////////////////////////////////////////////////////
 	template<typename T>
@@ -140,14 +140,14 @@ public:
 	///////////////////////////////////////////////////////////
 	/// \brief Define o background a partir de uma textura.
 	///
-	/// \param texture Referncia para o objeto `Texture` que ser utilizado
+	/// \param texture Referência para o objeto `Texture` que será utilizado
 	/// para definir a textura do background.
 	///
 	///////////////////////////////////////////////////////////
 	void SetBackground(const Texture* texture);
 
 	///////////////////////////////////////////////////////////
-	/// \brief Define a rea da viewport.
+	/// \brief Define a área da viewport.
 	///
 	/// \param x Coordenada X inicial da viewport.
 	/// \param y Coordenada Y inicial da viewport.
@@ -158,17 +158,17 @@ public:
 	void SetViewport(int x, int y, int width, int height);
 
 	///////////////////////////////////////////////////////////
-	/// \brief Obtm o retngulo da rea da viewport.
+	/// \brief Obtém o retângulo da área da viewport.
 	///
-	/// \return Referncia constante para o retngulo da viewport.
+	/// \return Referência constante para o retângulo da viewport.
 	///
 	///////////////////////////////////////////////////////////
 	const Rect& GetViewport() const;
 
 	///////////////////////////////////////////////////////////
-	/// \brief Obtm as dimenses da viewport.
+	/// \brief Obtém as dimensões da viewport.
 	///
-	/// \return Referncia constante para as dimenses da viewport.
+	/// \return Referência constante para as dimensões da viewport.
 	///
 	///////////////////////////////////////////////////////////
 	const ::Size& Size() const;
@@ -182,22 +182,22 @@ protected:
 	///////////////////////////////////////////////////////////
 	/// \brief Define o background a partir de um arquivo.
 	///
-	/// Este mtodo carrega uma textura a partir de um arquivo especificado e a 
+	/// Este método carrega uma textura a partir de um arquivo especificado e a 
 	/// define para o background.
 	///
-	/// \param file Caminho para o arquivo de textura que ser carregado e 
+	/// \param file Caminho para o arquivo de textura que será carregado e 
 	/// utilizado para definir a textura do sprite.
 	/// 
 	///////////////////////////////////////////////////////////
 	void SetBackground(const char* file);	
 
 	////////////////////////////////////////////////////////////
-	/// \brief Desenha o contedo adicional sobre a cena.
+	/// \brief Desenha o conteúdo adicional sobre a cena.
 	///
-	/// Este mtodo virtual  chamado aps todos os elementos principais
+	/// Este método virtual é chamado após todos os elementos principais
 	/// da cena, entidades e componentes serem desenhados, ideal para
 	/// renderizar objetos que devem aparecer sobre outros elementos,
-	/// como HUDs, textos, notificaes ou efeitos visuais que ficam em primeiro plano.
+	/// como HUDs, textos, notificações ou efeitos visuais que ficam em primeiro plano.
 	///
 	////////////////////////////////////////////////////////////
 	virtual void DrawOver() {};
@@ -205,21 +205,21 @@ protected:
 private:
 	friend class Component;
 
-	// Variveis da cena
+	// Variáveis da cena
 	std::shared_ptr<Texture>	 texture;	  ///< Textura carregada na cena
 	::Size						 size;
 	Rect						 viewport;
 
-	// Variveis de entidade				  
+	// Variáveis de entidade				  
 	ObjectsMap					 objHash;	  ///< Hash de objetos
 	std::list<Entity*>           objects;	  ///< Guarda objetos do tipo Entity	
 	std::list<Entity*>::iterator current;	  ///< Iterador para o objeto atual	
-	std::vector<Entity*>         created;	  ///< Vetor de objetos a serem inicializados (prximo frame)
+	std::vector<Entity*>         created;	  ///< Vetor de objetos a serem inicializados (próximo frame)
 	std::vector<Entity*>         destroy;	  ///< Vetor de objetos a serem destruidos (ao final do frame)
-	std::unordered_set<Entity*>  destroyable; ///< Objetos que sero destrudos pela cena
-	bool                         sortObj;	  ///< Controla a atualizao da profundidade dos objetos
+	std::unordered_set<Entity*>  destroyable; ///< Objetos que serão destruídos pela cena
+	bool                         sortObj;	  ///< Controla a atualização da profundidade dos objetos
 
-	// Variveis de componente		    
+	// Variáveis de componente		    
 	std::list<Collider*>		 colliders;	  ///< Lista com todos colisores instanciados
 };
 
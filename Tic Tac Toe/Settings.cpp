@@ -0,0 +1,140 @@
+#include "Settings.h"
+#include <fstream>
+#include <algorithm>
+#include <cstdlib>
+#include <cerrno>
+
+//--------------------------------------------------------------------------------------------------
+
+namespace
+{
+    // Converte o texto inteiro em número; falha com sobras, texto vazio ou fora do intervalo
+    bool ToLong(const std::string& text, long& value)
+    {
+        char* end;
+        errno = 0;
+        value = std::strtol(text.c_str(), &end, 10);
+
+        return !text.empty() && *end == '\0' && errno == 0;
+    }
+
+    bool ToFloat(const std::string& text, float& value)
+    {
+        char* end;
+        errno = 0;
+        value = std::strtof(text.c_str(), &end);
+
+        return !text.empty() && *end == '\0' && errno == 0;
+    }
+}
+
+//--------------------------------------------------------------------------------------------------
+
+const char* Settings::Usage()
+{
+    return "[--config arquivo] [--engine mcts|graph|minimax|alphabeta] [--iterations N | --time ms] "
+           "[--threads N] [--c valor] [--seed N] [--size px] [--book arquivo]";
+}
+
+//--------------------------------------------------------------------------------------------------
+
+bool Settings::Parse(int argc, char** argv)
+{
+    // Toda opção tem um valor: --chave valor
+    for (int i{ 1 }; i < argc; i += 2)
+    {
+        const std::string_view argument{ argv[i] };
+
+        if (!argument.starts_with("--") || i + 1 >= argc)
+            return false;
+
+        if (argument == "--config" ? !Load(argv[i + 1]) : !Set(argument.substr(2), argv[i + 1]))
+            return false;
+    }
+
+    return true;
+}
+
+//--------------------------------------------------------------------------------------------------
+
+bool Settings::Load(const char* path)
+{
+    std::ifstream file{ path };
+
+    if (!file)
+        return false;
+
+    for (std::string line; std::getline(file, line);)
+    {
+        // Descarta comentários e espaços nas pontas
+        line.erase(std::min(line.find('#'), line.size()));
+
+        const size_t first{ line.find_first_not_of(" \t\r") };
+        if (first == std::string::npos)
+            continue;
+
+        const size_t last{ line.find_last_not_of(" \t\r") };
+        line = line.substr(first, last - first + 1);
+
+        // A chave vai até o primeiro espaço; o restante é o valor
+        const size_t space{ line.find_first_of(" \t") };
+        if (space == std::string::npos)
+            return false;
+
+        const std::string key{ line.substr(0, space) };
+        const std::string value{ line.substr(line.find_first_not_of(" \t", space)) };
+
+        if (!Set(key, value))
+            return false;
+    }
+
+    return true;
+}
+
+//--------------------------------------------------------------------------------------------------
+
+bool Settings::Set(std::string_view key, const std::string& value)
+{
+    long number;
+    float real;
+
+    if (key == "engine")
+    {
+        if (value == "mcts")
+            ai = Mcts;
+        else if (value == "graph")
+            ai = Graph;
+        else if (value == "minimax")
+            ai = Minimax;
+        else if (value == "alphabeta")
+            ai = AlphaBeta;
+        else
+            return false;
+    }
+    else if (key == "iterations" && ToLong(value, number) && number > 0)
+        iterations = int(std::min(number, 1L << 30));
+    else if (key == "time" && ToFloat(value, real) && real > 0)
+    {
+        milliseconds = real;
+        iterations = 0;
+    }
+    else if (key == "threads" && ToLong(value, number) && number > 0)
+        threads = int(std::min(number, 256L));
+    else if (key == "c" && ToFloat(value, real) && real >= 0)
+        explorationConstant = real;
+    else if (key == "seed" && ToLong(value, number) && number >= 0)
+    {
+        seed = uint32_t(number);
+        seeded = true;
+    }
+    else if (key == "size" && ToLong(value, number) && number >= 150)
+        size = unsigned(std::min(number, 4096L));
+    else if (key == "book")
+        book = value == "none" ? std::string{} : value;
+    else
+        return false;
+
+    return true;
+}
+
+//--------------------------------------------------------------------------------------------------
@@ -0,0 +1,58 @@
+#ifndef QUANTVERSO_SETTINGS_H
+#define QUANTVERSO_SETTINGS_H
+
+//--------------------------------------------------------------------------------------------------
+
+#include <string>
+#include <string_view>
+#include <cstdint>
+
+//--------------------------------------------------------------------------------------------------
+
+////////////////////////////////////////////////////////////
+/// struct Settings
+/// \brief Configuração do jogo e da IA, vinda da linha de
+///        comando ou de um arquivo.
+///
+/// O arquivo tem uma opção por linha, "chave valor", com as
+/// chaves das opções sem "--"; '#' inicia um comentário. As
+/// opções são aplicadas na ordem: as que vêm depois de
+/// --config sobrepõem as do arquivo.
+///
+/// O orçamento é de iterações ou de tempo, valendo o último
+/// informado. Com semente fixa, orçamento de iterações e uma
+/// thread, a IA escolhe sempre as mesmas jogadas.
+///
+////////////////////////////////////////////////////////////
+struct Settings
+{
+    enum Ai
+    {
+        Mcts,
+        Graph,
+        Minimax,
+        AlphaBeta,
+    };
+
+    Ai          ai{ Mcts };
+    int         iterations{};                       // Iterações por jogada (0 = orçamento de tempo)
+    float       milliseconds{ 100.f };              // Tempo de busca por jogada
+    int         threads{ 1 };                       // Threads do MCTS em árvore
+    float       explorationConstant{ 0.70710678f }; // c do UCB1 (1 / sqrt(2))
+    uint32_t    seed{};
+    bool        seeded{};                           // Sem semente fixa, o gerador usa std::random_device
+    unsigned    size{ 600 };                        // Lado da janela em pixels
+    std::string book{ "Book.bin" };                 // Livro de aberturas (vazio = sem livro; "none" na opção)
+
+    bool Parse(int argc, char** argv);
+    bool Load(const char* path);
+
+    static const char* Usage();
+
+private:
+    bool Set(std::string_view key, const std::string& value);
+};
+
+//--------------------------------------------------------------------------------------------------
+
+#endif
@@ -15,15 +15,15 @@ Shape::Shape() :
 
 bool Shape::CheckCollision(const Rectangle* rect, const Circle* circle) const
 {
-    // Encontra o ponto mais prximo ao crculo dentro do retngulo
+    // Encontra o ponto mais próximo ao círculo dentro do retângulo
     float closestX{ std::max(float(rect->bounds.Left()), std::min(circle->position.x, float(rect->bounds.Right()))) };
     float closestY{ std::max(float(rect->bounds.Top()), std::min(circle->position.y, float(rect->bounds.Bottom()))) };
 
-    // Calcula a distncia entre o centro do crculo e o ponto mais prximo
+    // Calcula a distância entre o centro do círculo e o ponto mais próximo
     float distanceX{ circle->position.x - closestX };
     float distanceY{ circle->position.y - closestY };
 
-    // Se a distncia for menor ou igual ao raio, h coliso
+    // Se a distância for menor ou igual ao raio, há colisão
     return (distanceX * distanceX + distanceY * distanceY) <= (circle->Radius() * circle->Radius());
 }
 
@@ -51,11 +51,11 @@ bool Shape::CheckCollision(const Rectangle* rect, const Polygon* polygon) const
 
 bool Shape::CheckCollision(const Circle* circle, const Point* point) const
 {
-    // Calcula a distncia entre o ponto e o centro do crculo
+    // Calcula a distância entre o ponto e o centro do círculo
     float dx{ point->position.x - circle->position.x };
     float dy{ point->position.y - circle->position.y };
 
-    // Se a distncia for menor ou igual ao raio, h coliso
+    // Se a distância for menor ou igual ao raio, há colisão
     return (dx * dx + dy * dy) <= (circle->Radius() * circle->Radius());
 }
 
@@ -75,11 +75,11 @@ bool Shape::CheckCollision(const Point* point, const Polygon* polygon) const
 
     for (size_t i{}, j{ 1 }; j < polygon->Size(); i++, j++)
     {
-        // Condio para a interseo
+        // Condição para a interseção
         if ((vertices[i].y < point->position.y && vertices[j].y >= point->position.y) ||
             (vertices[j].y < point->position.y && vertices[i].y >= point->position.y)) 
         {
-            // Calcula a interseo
+            // Calcula a interseção
             float intersectX
             {
                 vertices[j].x -
@@ -88,7 +88,7 @@ bool Shape::CheckCollision(const Point* point, const Polygon* polygon) const
                 (vertices[j].y - vertices[i].y)
             };
 
-            // Verifica se o ponto est  esquerda da linha
+            // Verifica se o ponto está à esquerda da linha
             if (intersectX < point->position.x)
                 crossing = !crossing;
         }
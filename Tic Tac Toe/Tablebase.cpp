@@ -0,0 +1,105 @@
+#include "Tablebase.h"
+#include <fstream>
+
+//--------------------------------------------------------------------------------------------------
+
+static_assert(Tablebase::Positions == 10165779, "Contagem de posições do 4x4 inesperada");
+
+//--------------------------------------------------------------------------------------------------
+
+bool Tablebase::Open(const char* path)
+{
+    Close();
+
+    if (!file.Open(path))
+        return false;
+
+    // O cabeçalho deve bater e o arquivo deve ter exatamente 2 bits por posição
+    const Header& header{ *reinterpret_cast<const Header*>(file.Data()) };
+
+    if (file.Size() != sizeof(Header) + (Positions + 3) / 4 || header.magic != Magic ||
+        header.version != Version || header.positions != Positions)
+    {
+        Close();
+        return false;
+    }
+
+    values = reinterpret_cast<const uint8_t*>(file.Data() + sizeof(Header));
+
+    return true;
+}
+
+//--------------------------------------------------------------------------------------------------
+
+void Tablebase::Close()
+{
+    file.Close();
+    values = nullptr;
+}
+
+//--------------------------------------------------------------------------------------------------
+
+int Tablebase::BestMove(const Game& grid) const
+{
+    if (grid.IsTerminal())
+        return -1;
+
+    Mask x{ Mask(grid.Occupied(Player::X).Word(0)) };
+    Mask o{ Mask(grid.Occupied(Player::O).Word(0)) };
+
+    // X começa: é a vez de X quando os dois têm o mesmo número de pedras
+    const bool xToMove{ std::popcount(x) == std::popcount(o) };
+    Mask& own{ xToMove ? x : o };
+
+    int bestMove{ -1 };
+    Value bestValue{ Win };
+
+    for (Mask moves{ Mask(~(x | o)) }; moves; moves &= moves - 1)
+    {
+        const int move{ std::countr_zero(moves) };
+        const Mask bit{ Mask(1 << move) };
+
+        own |= bit;
+
+        // O valor do filho é do ponto de vista do adversário: a derrota dele é a melhor jogada
+        const bool wins{ HasLine(own) };
+        const Value value{ wins ? Loss : Lookup(x, o) };
+
+        own &= ~bit;
+
+        if (wins)
+            return move;
+
+        if (value != Illegal && (bestMove < 0 || value < bestValue))
+        {
+            bestValue = value;
+            bestMove = move;
+        }
+    }
+
+    return bestMove;
+}
+
+//--------------------------------------------------------------------------------------------------
+
+bool Tablebase::Write(const char* path, const std::vector<uint8_t>& values)
+{
+    if (values.size() != Positions)
+        return false;
+
+    // Quatro posições por byte, a primeira nos bits baixos
+    std::vector<uint8_t> packed((Positions + 3) / 4);
+
+    for (uint32_t index{}; index < Positions; ++index)
+        packed[index >> 2] |= uint8_t((values[index] & 3) << (2 * (index & 3)));
+
+    std::ofstream file{ path, std::ios::binary | std::ios::trunc };
+
+    const Header header{ Magic, Version, Positions };
+    file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    file.write(reinterpret_cast<const char*>(packed.data()), std::streamsize(packed.size()));
+
+    return bool(file);
+}
+
+//--------------------------------------------------------------------------------------------------
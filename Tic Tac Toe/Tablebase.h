@@ -0,0 +1,232 @@
+#ifndef QUANTVERSO_TABLEBASE_H
+#define QUANTVERSO_TABLEBASE_H
+
+//--------------------------------------------------------------------------------------------------
+
+#include "Grid.h"
+#include "MappedFile.h"
+#include <vector>
+
+//--------------------------------------------------------------------------------------------------
+
+////////////////////////////////////////////////////////////
+/// class Tablebase
+/// \brief Tabela resolvida do 4x4 (quatro em linha), 2 bits
+///        por posição, mapeada em memória.
+///
+/// Cada posição com contagens válidas (X começa) tem um
+/// índice denso dado por Rank(): camada pelo número de
+/// pedras, depois a combinação das casas de X e a das casas
+/// de O entre as livres, em ordem colexicográfica. A consulta
+/// é esse cálculo mais a leitura de 2 bits no arquivo.
+///
+/// A tabela é gerada offline pelo TablebaseMaker.
+///
+////////////////////////////////////////////////////////////
+class Tablebase
+{
+public:
+    using Game = Grid<4, 4, 4>;
+    using Mask = uint16_t;
+
+    // Resultado para o jogador da vez
+    enum Value : uint8_t
+    {
+        Illegal,
+        Loss,
+        Draw,
+        Win,
+    };
+
+    static constexpr int      Size{ Game::Size };
+    static constexpr int      Symmetries{ 8 };
+    static constexpr uint32_t Magic{ 0x42545651 };  // "QVTB"
+    static constexpr uint32_t Version{ 1 };
+
+    bool Open(const char* path);
+    void Close();
+    bool IsOpen() const;
+
+    Value Lookup(Mask x, Mask o) const;
+    Value Lookup(const Game& grid) const;
+
+    // Jogada que preserva o resultado, preferindo vencer de imediato (-1 se terminal)
+    int BestMove(const Game& grid) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Índice denso da posição em [0, Positions).
+    ///
+    /// Exige X com o mesmo número de pedras de O ou uma a mais.
+    ///
+    ////////////////////////////////////////////////////////////
+    static uint32_t Rank(Mask x, Mask o);
+
+    static constexpr bool HasLine(Mask mask);
+    static constexpr Mask Transform(Mask mask, int symmetry);
+
+    // Empacota `values` (um por posição, na ordem de Rank) a 2 bits e grava a tabela
+    static bool Write(const char* path, const std::vector<uint8_t>& values);
+
+private:
+    struct Header
+    {
+        uint32_t magic;
+        uint32_t version;
+        uint64_t positions;
+    };
+
+    // Linhas, colunas e diagonais (bit = linha * 4 + coluna)
+    static constexpr std::array<Mask, 10> lines
+    {
+        0x000F, 0x00F0, 0x0F00, 0xF000,
+        0x1111, 0x2222, 0x4444, 0x8888,
+        0x8421, 0x1248
+    };
+
+    // Coeficientes binomiais C(n, k) para n, k <= 16
+    static constexpr std::array<std::array<uint32_t, Size + 1>, Size + 1> binomial{ [] {
+        std::array<std::array<uint32_t, Size + 1>, Size + 1> table{};
+
+        for (int n{}; n <= Size; ++n)
+        {
+            table[n][0] = 1;
+            for (int k{ 1 }; k <= n; ++k)
+                table[n][k] = table[n - 1][k - 1] + table[n - 1][k];
+        }
+
+        return table;
+    }() };
+
+    // Início de cada camada (número de pedras); a última posição é o total
+    static constexpr std::array<uint32_t, Size + 2> layers{ [] {
+        std::array<uint32_t, Size + 2> offsets{};
+
+        for (int stones{}; stones <= Size; ++stones)
+        {
+            const int x{ (stones + 1) / 2 }, o{ stones / 2 };
+            offsets[stones + 1] = offsets[stones] + binomial[Size][x] * binomial[Size - x][o];
+        }
+
+        return offsets;
+    }() };
+
+    static constexpr Mask FlipColumns(Mask mask);
+    static constexpr Mask FlipRows(Mask mask);
+    static constexpr Mask Transpose(Mask mask);
+
+    MappedFile     file;
+    const uint8_t* values{};
+
+public:
+    static constexpr uint32_t Positions{ layers[Size + 1] };
+};
+
+//--------------------------------------------------------------------------------------------------
+
+inline bool Tablebase::IsOpen() const
+{
+    return file.IsOpen();
+}
+
+//--------------------------------------------------------------------------------------------------
+
+inline uint32_t Tablebase::Rank(Mask x, Mask o)
+{
+    const int stonesX{ std::popcount(x) }, stonesO{ std::popcount(o) };
+    uint32_t rankX{}, rankO{};
+
+    // Soma de C(posição, ordem) de cada pedra; as de O contam só as casas sem X
+    for (int square{}, countX{}, countO{}, free{}; square < Size; ++square)
+    {
+        const Mask bit{ Mask(1 << square) };
+
+        if (x & bit)
+            rankX += binomial[square][++countX];
+        else
+        {
+            if (o & bit)
+                rankO += binomial[free][++countO];
+
+            free++;
+        }
+    }
+
+    return layers[stonesX + stonesO] + rankX * binomial[Size - stonesX][stonesO] + rankO;
+}
+
+//--------------------------------------------------------------------------------------------------
+
+inline Tablebase::Value Tablebase::Lookup(Mask x, Mask o) const
+{
+    const uint32_t index{ Rank(x, o) };
+    return Value((values[index >> 2] >> (2 * (index & 3))) & 3);
+}
+
+//--------------------------------------------------------------------------------------------------
+
+inline Tablebase::Value Tablebase::Lookup(const Game& grid) const
+{
+    return Lookup(Mask(grid.Occupied(Player::X).Word(0)), Mask(grid.Occupied(Player::O).Word(0)));
+}
+
+//--------------------------------------------------------------------------------------------------
+
+inline constexpr bool Tablebase::HasLine(Mask mask)
+{
+    for (const Mask line : lines)
+    {
+        if ((mask & line) == line)
+            return true;
+    }
+
+    return false;
+}
+
+//--------------------------------------------------------------------------------------------------
+
+inline constexpr Tablebase::Mask Tablebase::FlipColumns(Mask mask)
+{
+    // Inverte os 4 bits de cada linha
+    mask = Mask(((mask & 0x5555) << 1) | ((mask >> 1) & 0x5555));
+    return Mask(((mask & 0x3333) << 2) | ((mask >> 2) & 0x3333));
+}
+
+//--------------------------------------------------------------------------------------------------
+
+inline constexpr Tablebase::Mask Tablebase::FlipRows(Mask mask)
+{
+    return Mask((mask << 12) | ((mask & 0x00F0) << 4) | ((mask >> 4) & 0x00F0) | (mask >> 12));
+}
+
+//--------------------------------------------------------------------------------------------------
+
+inline constexpr Tablebase::Mask Tablebase::Transpose(Mask mask)
+{
+    // Duas trocas delta: blocos 1x1 dentro de cada 2x2 e depois os blocos 2x2
+    Mask swap{ Mask(((mask >> 3) ^ mask) & 0x0A0A) };
+    mask ^= swap ^ Mask(swap << 3);
+
+    swap = Mask(((mask >> 6) ^ mask) & 0x00CC);
+    return mask ^ swap ^ Mask(swap << 6);
+}
+
+//--------------------------------------------------------------------------------------------------
+
+inline constexpr Tablebase::Mask Tablebase::Transform(Mask mask, int symmetry)
+{
+    // Mesma composição de Board::Transform: espelha colunas, espelha linhas e transpõe
+    if (symmetry & 1)
+        mask = FlipColumns(mask);
+
+    if (symmetry & 2)
+        mask = FlipRows(mask);
+
+    if (symmetry & 4)
+        mask = Transpose(mask);
+
+    return mask;
+}
+
+//--------------------------------------------------------------------------------------------------
+
+#endif
@@ -28,15 +28,15 @@ public:
 private:
 	friend class Window;
 
-	inline static unsigned instances; ///< Contador de instncias
+	inline static unsigned instances; ///< Contador de instâncias
 
 	std::string	 text;	  ///< Texto a ser renderizado
 	unsigned	 size;	  ///< Tamanho da fonte
 	::Color		 color;	  ///< Cor do texto
 	TTF_Font*	 font;	  ///< Fonte carregada do arquivo .ttf
 	SDL_Texture* texture; ///< Textura renderizada
-	SDL_Surface* surface; ///< Superfcie de renderizao
-	SDL_Rect	 rect;	  ///< Rect de renderizao
+	SDL_Surface* surface; ///< Superfície de renderização
+	SDL_Rect	 rect;	  ///< Rect de renderização
 	
 };
 
@@ -1,15 +1,24 @@
 #include "TicTacToe.h"
 #include "Minimax.h"
-#include "MCTS.h"
-#include <cmath>
 
 //--------------------------------------------------------------------------------------------------
 
-TicTacToe::TicTacToe() :
+TicTacToe::TicTacToe(const Settings& settings) :
+    settings{ settings },
     board{},
     size{ GetViewport().w },
     step{}
 {
+    // Sem o livro, todas as jogadas da IA vêm da busca
+    if (!settings.book.empty())
+        book.Open(settings.book.c_str());
+
+    // Semente fixa: a mesma sequência de jogadas do humano recebe as mesmas respostas
+    if (settings.seeded)
+    {
+        tree.Seed(settings.seed);
+        graph.Seed(settings.seed);
+    }
 }
 
 //--------------------------------------------------------------------------------------------------
@@ -29,8 +38,35 @@ void TicTacToe::Start()
 void TicTacToe::Update()
 {
     if (Keyboard::KeyDown(Keyboard::Home))
+    {
+        // Nova partida: nada da anterior é reaproveitado, nem uma busca interrompida pela metade
+        tree.Cancel();
+        tree.Clear();
+        graph.Cancel();
+        graph.Clear();
         board = Board{};
 
+        // Cada partida recomeça do mesmo estado do gerador
+        if (settings.seeded)
+        {
+            tree.Seed(settings.seed);
+            graph.Seed(settings.seed);
+        }
+    }
+
+    // A IA pensa em segundo plano; a cena continua sendo desenhada enquanto isso
+    if (tree.IsSearching())
+    {
+        tree.Poll(board);
+        return;
+    }
+
+    if (graph.IsSearching())
+    {
+        graph.Poll(board);
+        return;
+    }
+
     if (board.CheckWinner() == Player::None)
     {
         if (Mouse::ButtonDown(Mouse::Left))
@@ -39,15 +75,14 @@ void TicTacToe::Update()
 
             if (mouse.isInViewport)
             {
-                auto& cell{ board[mouse.position.y / step][mouse.position.x / step] };
+                auto cell{ board[mouse.position.y / step][mouse.position.x / step] };
 
                 if (cell == Player::None)
                 {
                     cell = Player::X;
 
-                    //Minimax::Search(board);
-
-                    MCTS::Search(board, 1000, 1 / std::sqrtf(2));
+                    if (board.CheckWinner() == Player::None && board.Available())
+                        Respond();
                 }
             }
         }
@@ -56,14 +91,56 @@ void TicTacToe::Update()
 
 //--------------------------------------------------------------------------------------------------
 
+void TicTacToe::Respond()
+{
+    // Posições do livro são respondidas na hora, sem busca
+    if (int move, value; book.Probe(board, move, value))
+    {
+        board.MakeMove(move);
+        return;
+    }
+
+    const float c{ settings.explorationConstant };
+
+    switch (settings.ai)
+    {
+    case Settings::Mcts:
+        // As buscas do MCTS rodam em segundo plano; a cena continua sendo desenhada
+        if (settings.iterations)
+            tree.SearchAsync(board, settings.iterations, c, settings.threads);
+        else
+            tree.SearchAsync(board, settings.milliseconds, c, settings.threads);
+        break;
+
+    case Settings::Graph:
+        if (settings.iterations)
+            graph.SearchAsync(board, settings.iterations, c);
+        else
+            graph.SearchAsync(board, settings.milliseconds, c);
+        break;
+
+    // Minimax e alfa-beta resolvem o 3x3 na hora, sem travar o quadro
+    case Settings::Minimax:
+        Minimax::Search(board);
+        break;
+
+    case Settings::AlphaBeta:
+        if (const auto result{ alphaBeta.Search(board, board.Turn()) }; result.move >= 0)
+            board.MakeMove(result.move);
+        break;
+    }
+}
+
+//--------------------------------------------------------------------------------------------------
+
 void TicTacToe::Draw()
 {
     Scene::Draw();
 
-    // Configura a cor de renderizao
+    // Configura a cor de renderização
     window.SetRenderDrawColor(Color::White);
 
-    // Dois teros da janela da cena
+    // Dois terços da janela da cena
     static const int twoSteps{ 2 * step };
 
     // Desenha as linhas verticais
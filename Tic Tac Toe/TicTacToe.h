@@ -5,18 +5,26 @@
 
 #include "Scene.h"
 #include "Board.h"
+#include "MCTS.h"
+#include "Graph.h"
+#include "AlphaBeta.h"
+#include "Book.h"
+#include "Settings.h"
 
 //--------------------------------------------------------------------------------------------------
 
 class TicTacToe : public Scene
 {
 public:
-    TicTacToe();
+    explicit TicTacToe(const Settings& settings);
 
     void Start();
     void Update();
     void Draw();
 
+private:
+    void Respond();
+
 public:
     class PlayerX
     {
@@ -48,9 +56,14 @@ public:
 
     } playerO;
 
-    Board      board;
-    const int& size;
-    int        step;
+    Settings    settings;
+    Board       board;
+    MCTS::Tree  tree;
+    MCTS::Graph graph;
+    AlphaBeta   alphaBeta;
+    Book        book;
+    const int&  size;
+    int         step;
 };
 
 //--------------------------------------------------------------------------------------------------
@@ -35,7 +35,7 @@ public:
 			this->x = int(x);
 			this->y = int(y);
 
-			// Percentual de deslocamento relativo as dimenses.
+			// Percentual de deslocamento relativo as dimensões.
 			perX = x ? w / x : 0;
 			perY = y ? h / y : 0;
 		}
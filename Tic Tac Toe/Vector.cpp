@@ -26,7 +26,7 @@ void Vector::Add(const Vector& vector)
 	// Calcula a magnitude
 	magnitude = std::hypotf(rx, ry);
 
-	// Calcula o ngulo em radianos e converte para graus
+	// Calcula o ângulo em radianos e converte para graus
 	angle.degrees = float((angle.radians = std::atan2f(ry, rx)) * 180 / M_PI);
 }
 
@@ -34,7 +34,7 @@ void Window::Create()
 			return;
 		}
 
-		// Cria a janela grfica
+		// Cria a janela gráfica
 		window = SDL_CreateWindow(title, SDL_WINDOWPOS_CENTERED, SDL_WINDOWPOS_CENTERED, int(size.width), int(size.height), SDL_WINDOW_SHOWN);
 		if (!window)
 		{
@@ -52,7 +52,7 @@ void Window::Create()
 			return;
 		}
 
-		// Habilita mistura para desenhar com transparncia.
+		// Habilita mistura para desenhar com transparência.
 		SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_BLEND);
 	}
 }